@@ -29,8 +29,8 @@ public:
             write_len_(write_len), write_nloop_(write_nloop) {
     }
 
-    bool operator ()(std::shared_ptr<tateyama::api::server::request> req,
-            std::shared_ptr<tateyama::api::server::response> res) override {
+    bool operator ()(std::shared_ptr<tateyama::api::server::request> const& req,
+            std::shared_ptr<tateyama::api::server::response> const& res) override {
         std::string payload { req->payload() };
         //
         std::shared_ptr<tateyama::api::server::data_channel> channel;
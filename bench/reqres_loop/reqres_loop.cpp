@@ -28,8 +28,8 @@ public:
             comm_type_(c_type) {
     }
 
-    bool operator ()(std::shared_ptr<tateyama::api::server::request> req,
-            std::shared_ptr<tateyama::api::server::response> res) override {
+    bool operator ()(std::shared_ptr<tateyama::api::server::request> const& req,
+            std::shared_ptr<tateyama::api::server::response> const& res) override {
         switch (comm_type_) {
         case comm_type::sync:
         case comm_type::async:
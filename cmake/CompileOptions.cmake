@@ -49,3 +49,20 @@ if(ENABLE_ALTIMETER)
     message("altimeter enabled")
     add_definitions(-DENABLE_ALTIMETER)
 endif()
+
+# profile-guided optimization: build once with PROFILE_GENERATE=ON, run a representative
+# workload, then rebuild with PROFILE_DATA pointing at the collected profiles so the hot
+# request paths get inlined and the cold arms outlined
+if(PROFILE_GENERATE AND PROFILE_DATA)
+    message(FATAL_ERROR "PROFILE_GENERATE and PROFILE_DATA are mutually exclusive")
+endif()
+if(PROFILE_GENERATE)
+    message("profile generation enabled")
+    add_compile_options(-fprofile-generate)
+    add_link_options(-fprofile-generate)
+endif()
+if(PROFILE_DATA)
+    message("profile use enabled: ${PROFILE_DATA}")
+    add_compile_options(-fprofile-use=${PROFILE_DATA} -fprofile-correction)
+    add_link_options(-fprofile-use=${PROFILE_DATA})
+endif()
@@ -129,9 +129,9 @@ bool fill_from_flags(
 }
 
 void show_result(
-    std::vector<queue> const& queues,
+    std::vector<impl::worker_queues<task>> const& queues,
     std::size_t duration_ms,
-    std::vector<impl::worker_stat> const& worker_stats,
+    std::vector<tateyama::cache_line_storage<impl::worker_stat>> const& worker_stats,
     bool debug
 ) {
     std::size_t total_executions = 0;
@@ -139,7 +139,8 @@ void show_result(
     if (debug) {
         LOG(INFO) << "======= begin debug info =======";
     }
-    for(auto&& q: const_cast<std::vector<queue>&>(queues)) {
+    for(auto&& e: const_cast<std::vector<impl::worker_queues<task>>&>(queues)) {
+        auto& q = e.local;
         task t{};
         std::size_t queue_total = 0;
         while(q.try_pop(t)) {
@@ -155,7 +156,7 @@ void show_result(
     std::size_t idx = 0;
     for(auto&& w : worker_stats) {
         if (debug) {
-            LOG(INFO) << cwidth(2) << idx << "-th thread executions " << format(w.count_)<< " tasks";
+            LOG(INFO) << cwidth(2) << idx << "-th thread executions " << format(w.data.count_)<< " tasks";
         }
         ++idx;
     }
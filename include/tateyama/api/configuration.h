@@ -18,7 +18,9 @@
 #include <string>
 #include <optional>
 #include <cstdlib>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <iterator>
 #include <sstream>
@@ -27,7 +29,6 @@
 #include <boost/property_tree/ptree.hpp>
 #include <boost/property_tree/ini_parser.hpp>
 #include <boost/lexical_cast.hpp>
-#include <boost/foreach.hpp>
 #include <boost/algorithm/string.hpp>
 
 #include <glog/logging.h>
@@ -38,6 +39,82 @@ namespace tateyama::api::configuration {
 
 class whole;
 
+namespace details {
+
+/**
+ * @brief streambuf view over an existing character range
+ * @details allows feeding string_view contents (e.g. the build-time default configuration) to an
+ * istream-based parser without copying them into a std::string first
+ */
+struct membuf : std::streambuf {
+    membuf(char const* base, char const* end) {
+        auto* b = const_cast<char*>(base);  //NOLINT(cppcoreguidelines-pro-type-const-cast) - read only usage
+        auto* e = const_cast<char*>(end);  //NOLINT(cppcoreguidelines-pro-type-const-cast) - read only usage
+        setg(b, b, e);
+    }
+};
+
+inline std::string_view trim(std::string_view s) {
+    constexpr std::string_view spaces = " \t\r";
+    auto b = s.find_first_not_of(spaces);
+    if (b == std::string_view::npos) {
+        return {};
+    }
+    auto e = s.find_last_not_of(spaces);
+    return s.substr(b, e - b + 1);
+}
+
+/**
+ * @brief parse ini-formatted content directly into the tree
+ * @details minimal scanner for the build-time default configuration covering only the subset it
+ * uses: `[section]` headers, `key=value` entries, blank lines and full-line comments. Unlike the
+ * boost parser this performs no per-line stream extraction or exception setup.
+ * @return true if the whole content was recognized
+ * @return false if a construct outside the subset was found - the caller should fall back to the
+ * full boost parser for authoritative handling (and error reporting)
+ */
+inline bool parse_simple_ini(std::string_view content, boost::property_tree::ptree& tree) {
+    boost::property_tree::ptree* current = std::addressof(tree);
+    std::size_t pos = 0;
+    while (pos <= content.size()) {
+        auto eol = content.find('\n', pos);
+        auto line = trim(content.substr(pos, eol == std::string_view::npos ? std::string_view::npos : eol - pos));
+        if (eol == std::string_view::npos) {
+            pos = content.size() + 1;
+        } else {
+            pos = eol + 1;
+        }
+        if (line.empty() || line.front() == ';' || line.front() == '#') {
+            continue;
+        }
+        if (line.front() == '[') {
+            if (line.back() != ']') {
+                return false;
+            }
+            auto name = trim(line.substr(1, line.size() - 2));
+            if (name.empty()) {
+                return false;
+            }
+            // push_back keeps the key verbatim - put() would interpret dots as path separators
+            current = std::addressof(tree.push_back({std::string{name}, boost::property_tree::ptree{}})->second);
+            continue;
+        }
+        auto eq = line.find('=');
+        if (eq == std::string_view::npos || current == std::addressof(tree)) {
+            return false;
+        }
+        auto key = trim(line.substr(0, eq));
+        auto value = trim(line.substr(eq + 1));
+        if (key.empty()) {
+            return false;
+        }
+        current->push_back({std::string{key}, boost::property_tree::ptree{std::string{value}}});
+    }
+    return true;
+}
+
+}  // namespace details
+
 class section {
 public:
     section (boost::property_tree::ptree& pt, boost::property_tree::ptree& dt, whole* parent, bool default_required) : property_tree_(pt), default_tree_(dt), default_valid_(true), parent_(parent), default_required_(default_required) {}
@@ -287,12 +364,12 @@ private:
         check_done_ = true;
 
         bool rv = true;
-        BOOST_FOREACH(const boost::property_tree::ptree::value_type &s, property_tree_) {
+        for (auto const& s : property_tree_) {
             auto& section_name = s.first;
             bool default_required = (section_name != "glog");
             try {
                 boost::property_tree::ptree& default_section = default_tree_.get_child(section_name);
-                BOOST_FOREACH(const boost::property_tree::ptree::value_type &p, s.second) {
+                for (auto const& p : s.second) {
                     try {
                         default_section.get<std::string>(p.first);
                     } catch (boost::property_tree::ptree_error &e) {
@@ -316,11 +393,33 @@ private:
 
     static std::string_view default_property();
 
+    /**
+     * @brief get the parsed tree for the given default configuration content
+     * @details the default configuration contents are fixed at build time, so each distinct content is
+     * parsed only once and the resulting tree is reused by the subsequent whole constructions
+     */
+    static boost::property_tree::ptree const& parsed_default_tree(std::string_view default_property) {
+        static std::mutex mutex{};
+        static std::map<std::string, boost::property_tree::ptree, std::less<>> cache{};
+        std::unique_lock lk{mutex};
+        if (auto it = cache.find(default_property); it != cache.end()) {
+            return it->second;
+        }
+        boost::property_tree::ptree tree{};
+        if (! details::parse_simple_ini(default_property, tree)) {
+            // the content uses a construct outside the simple subset - let boost handle it
+            tree.clear();
+            // the content typically lives in program rodata, so parse it in place instead of copying
+            details::membuf buf{default_property.data(), default_property.data() + default_property.size()};  //NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            std::istream is{std::addressof(buf)};
+            boost::property_tree::read_ini(is, tree);
+        }
+        return cache.emplace(std::string{default_property}, std::move(tree)).first->second;
+    }
+
     void initialize(std::istream& content, std::string_view default_property) {
-        auto default_conf_string = std::string(default_property);
-        if (!default_conf_string.empty()) {
-            std::istringstream default_iss(default_conf_string);  // NOLINT
-            boost::property_tree::read_ini(default_iss, default_tree_);
+        if (!default_property.empty()) {
+            default_tree_ = parsed_default_tree(default_property);
             default_valid_ = true;
         } else {
             default_valid_ = false;
@@ -332,8 +431,11 @@ private:
             vlog_info_ << "error reading input, thus we use default property only. msg:" << e.what() << std::endl;
         }
         if (default_valid_) {
-            BOOST_FOREACH(const boost::property_tree::ptree::value_type &v, default_tree_) {
-                auto& dt = default_tree_.get_child(v.first);
+            // one section entry per default tree child - reserve up front to avoid rehashing
+            map_.reserve(default_tree_.size());
+            for (auto&& v : default_tree_) {
+                // v.second is the section subtree itself - no need to look it up again by name
+                auto& dt = v.second;
                 bool default_required = (v.first != "glog");
                 if (property_file_exist_) {
                     try {
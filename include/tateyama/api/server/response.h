@@ -85,6 +85,29 @@ public:
      */
     virtual status body(std::string_view body) = 0;
 
+    /**
+     * @brief setter of the response body moving the data in
+     * @param body the response body data, moved out of the argument
+     * @return status::ok when successful
+     * @return other code when error occurs
+     * @details implementations that store the body (rather than writing it through) may take
+     * ownership of the argument and skip the copy. The default forwards to body(std::string_view).
+     * @attention this function is not thread-safe and should be called from single thread at a time.
+     */
+    virtual status body(std::string&& body) {  //NOLINT(cppcoreguidelines-rvalue-reference-param-not-moved)
+        return this->body(std::string_view{body});
+    }
+
+    /**
+     * @brief setter of the response body
+     * @param body the response body data
+     * @details disambiguation for string literals, which convert equally well to std::string_view
+     * and std::string
+     */
+    status body(char const* body) {
+        return this->body(std::string_view{body});
+    }
+
     /**
      * @brief retrieve output data channel
      * @param name the name of the output
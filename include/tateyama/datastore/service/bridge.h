@@ -63,8 +63,8 @@ public:
     bool shutdown(framework::environment&) override;
 
     bool operator()(
-        std::shared_ptr<request> req,
-        std::shared_ptr<response> res) override;
+        std::shared_ptr<request> const& req,
+        std::shared_ptr<response> const& res) override;
 
     /**
      * @brief create empty object
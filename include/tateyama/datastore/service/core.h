@@ -25,6 +25,14 @@
 #include <tateyama/datastore/resource/bridge.h>
 #include <limestone/api/datastore.h>
 
+namespace google::protobuf {
+class Arena;
+}
+
+namespace tateyama::proto::datastore::request {
+class Request;
+}
+
 namespace tateyama::datastore::service {
 
 using tateyama::api::server::request;
@@ -73,12 +81,40 @@ public:
     );
 
 private:
+    /**
+     * @brief per-command handler
+     * @details each command of the request oneof is handled by one member function so that
+     * operator() dispatches with a single indirect call through a table indexed by command_case
+     */
+    using command_handler = bool (core::*)(
+        tateyama::proto::datastore::request::Request const& rq,
+        const std::shared_ptr<request>& req,
+        const std::shared_ptr<response>& res,
+        google::protobuf::Arena& arena
+    );
+
     std::shared_ptr<tateyama::api::configuration::whole> cfg_{};
     tateyama::datastore::resource::bridge* resource_{};
 
     std::unique_ptr<limestone_backup> backup_{};
     std::uint64_t backup_id_{};
     std::unique_ptr<limestone::api::backup_detail> backup_detail_{};
+
+    bool handle_backup_begin(tateyama::proto::datastore::request::Request const& rq,
+        const std::shared_ptr<request>& req, const std::shared_ptr<response>& res,
+        google::protobuf::Arena& arena);
+    bool handle_backup_detail_begin(tateyama::proto::datastore::request::Request const& rq,
+        const std::shared_ptr<request>& req, const std::shared_ptr<response>& res,
+        google::protobuf::Arena& arena);
+    bool handle_backup_end(tateyama::proto::datastore::request::Request const& rq,
+        const std::shared_ptr<request>& req, const std::shared_ptr<response>& res,
+        google::protobuf::Arena& arena);
+    bool handle_backup_estimate(tateyama::proto::datastore::request::Request const& rq,
+        const std::shared_ptr<request>& req, const std::shared_ptr<response>& res,
+        google::protobuf::Arena& arena);
+    bool handle_restore_begin(tateyama::proto::datastore::request::Request const& rq,
+        const std::shared_ptr<request>& req, const std::shared_ptr<response>& res,
+        google::protobuf::Arena& arena);
 };
 
 }
@@ -65,8 +65,8 @@ public:
     bool shutdown(environment&) override;
 
     bool operator()(
-        std::shared_ptr<request> req,
-        std::shared_ptr<response> res) override;
+        std::shared_ptr<request> const& req,
+        std::shared_ptr<response> const& res) override;
 
     /**
      * @see `tateyama::framework::component::label()`
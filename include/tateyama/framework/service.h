@@ -41,8 +41,8 @@ public:
      * @brief interface to exchange request and response
      */
     virtual bool operator()(
-        std::shared_ptr<request> req,
-        std::shared_ptr<response> res) = 0;
+        std::shared_ptr<request> const& req,
+        std::shared_ptr<response> const& res) = 0;
 
 };
 
@@ -15,7 +15,7 @@
  */
 #pragma once
 
-#include <map>
+#include <utility>
 #include <vector>
 
 #include <tateyama/api/server/response.h>
@@ -38,10 +38,10 @@ public:
      * @param session_id session identifier of the response
      * @param body_head body head of the response
      * @param body body of the response
-     * @param data_map all data written to all channels (key: channel name, value: written data)
+     * @param data_map all data written to all channels (first: channel name, second: written data)
      */
     buffered_response(std::size_t session_id, std::string_view body_head,
-            std::string_view body, std::map<std::string, std::vector<std::string>, std::less<>> &&data_map);
+            std::string_view body, std::vector<std::pair<std::string, std::vector<std::string>>> &&data_map);
 
     /**
      * @brief create response object
@@ -95,7 +95,11 @@ private:
     std::size_t session_id_ { };
     std::string body_head_ { };
     std::string body_ { };
-    std::map<std::string, std::vector<std::string>, std::less<>> data_map_ { };
+    /*
+     * channel name and written data pairs; the number of channels per response is small, so a
+     * flat vector with linear search beats a node-based map and costs no per-entry allocation
+     */
+    std::vector<std::pair<std::string, std::vector<std::string>>> data_map_ { };
     proto::diagnostics::Record error_rec_ { };
 };
 
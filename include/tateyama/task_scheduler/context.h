@@ -133,7 +133,9 @@ public:
 
 private:
     std::size_t index_{};
-    std::size_t last_steal_from_{};
+    // index_ above is written only on construction, while last_steal_from_ is updated on every
+    // steal attempt, so keep them on separate cache lines to avoid invalidating readers of index_
+    cache_align std::size_t last_steal_from_{};
     impl::periodic_notifier local_first_notifier_{};
     bool task_is_stolen_{};
     impl::thread_control* thread_{};
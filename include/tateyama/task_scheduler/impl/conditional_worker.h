@@ -20,7 +20,7 @@
 #include <ios>
 #include <functional>
 #include <emmintrin.h>
-#include <deque>
+#include <vector>
 
 #include <glog/logging.h>
 #include <boost/exception/all.hpp>
@@ -82,7 +82,8 @@ private:
 /**
  * @brief condition watcher worker object
  * @details this represents the worker logic running on watcher thread that processes conditional task queue
- * @note this object is just a logic object and doesn't hold dynamic state, so safely be copied into thread_control.
+ * @note this object holds only logic and reusable scratch storage (no externally visible state), so safely
+ * be copied into thread_control.
  */
 template <class T>
 class cache_align conditional_worker {
@@ -119,6 +120,8 @@ public:
         // reconstruct the queues so that they are on same numa node
         (*q_).reconstruct();
         ctx.thread(info.thread());
+        // the interval is fixed after startup, so cache it and save the cfg indirection per cycle
+        watcher_interval_ = std::chrono::microseconds{cfg_->watcher_interval()};
     }
 
     /**
@@ -130,18 +133,21 @@ public:
      */
     bool process_next() {
         conditional_task t{};
-        std::deque<conditional_task> negatives{};
+        // clear() keeps the capacity, so after warm-up no allocation happens on the watch cycle
+        negatives_.clear();
+        task_fired_ = false;
         while(q_->try_pop(t)) {
             if(execute_task(true, t)) {
                 execute_task(false, t);
+                task_fired_ = true;
                 continue;
             }
-            negatives.emplace_back(std::move(t));
+            negatives_.emplace_back(std::move(t));
         }
-        if(negatives.empty()) {
+        if(negatives_.empty()) {
             return false;
         }
-        for(auto&& e : negatives) {
+        for(auto&& e : negatives_) {
             q_->push(std::move(e));
         }
         return true;
@@ -151,23 +157,43 @@ public:
      * @brief the condition watcher worker body
      */
     void operator()(conditional_worker_context& ctx) {
-        conditional_task t{};
+        auto const interval = watcher_interval_;
+        auto current = interval;
         while(q_->active()) {
             auto r = process_next();
             if(! q_->active()) {
                 break;
             }
             if(! r) {
+                // queue is drained - no periodic check needed until a producer activates this thread
+                current = interval;
                 ctx.thread()->suspend();
                 continue;
             }
-            ctx.thread()->suspend(std::chrono::microseconds{cfg_->watcher_interval()});
+            // back off the polling interval while no condition fires, so an idle watcher does not
+            // keep waking up. Newly scheduled tasks activate() the thread, so no wakeup is missed.
+            ctx.thread()->suspend(current);
+            if(task_fired_) {
+                current = interval;
+            } else {
+                current = std::min(current * 2, interval * max_backoff_factor);
+            }
         }
     }
 
 private:
+    // the maximum factor that the polling interval can grow to by exponential backoff
+    constexpr static int max_backoff_factor = 16;
+
     task_scheduler_cfg const* cfg_{};
     basic_queue<conditional_task>* q_{};
+    // scratch storage for the tasks whose condition was not met - member (rather than local)
+    // so that its capacity is reused across process_next() calls
+    std::vector<conditional_task> negatives_{};
+    // whether any condition was met on the last process_next() call - used to reset the backoff
+    bool task_fired_{};
+    // cache of cfg_->watcher_interval(), set on init() since the value never changes afterwards
+    std::chrono::microseconds watcher_interval_{0};
 
     bool execute_task(bool check_condition, conditional_task& t) {
         bool ret{};
@@ -19,6 +19,7 @@
 #include <variant>
 #include <ios>
 #include <functional>
+#include <vector>
 
 #include <glog/logging.h>
 
@@ -45,10 +46,38 @@ public:
         origin_.enqueue(std::move(t));
     }
 
+    /**
+     * @brief push the tasks in [first, last) moving out the elements
+     * @details uses the bulk enqueue so the queue synchronization is paid once for the whole range
+     */
+    void push_bulk(task* first, task* last) {
+        origin_.enqueue_bulk(std::make_move_iterator(first), static_cast<std::size_t>(last - first));
+    }
+
     bool try_pop(task& t) {
         return origin_.try_dequeue(t);
     }
 
+    /**
+     * @brief visit the queued tasks
+     * @details moodycamel queue has no iteration api, so this drains the elements to a local buffer,
+     * visits them, and pushes them back in one bulk operation.
+     * Not thread-safe - intended for diagnostics where best-effort accuracy suffices.
+     */
+    template <class F>
+    void visit(F&& visitor) {
+        std::vector<task> backup{};
+        backup.reserve(size());
+        task t{};
+        while(origin_.try_dequeue(t)) {
+            visitor(t);
+            backup.emplace_back(std::move(t));
+        }
+        if(! backup.empty()) {
+            origin_.enqueue_bulk(std::make_move_iterator(backup.data()), backup.size());
+        }
+    }
+
     [[nodiscard]] std::size_t size() const {
         return origin_.size_approx();
     }
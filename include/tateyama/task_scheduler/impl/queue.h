@@ -54,10 +54,28 @@ public:
         origin_.push(std::move(t));
     }
 
+    /**
+     * @brief push the tasks in [first, last) moving out the elements
+     * @details bulk version of push that amortizes the queue synchronization over the range
+     */
+    void push_bulk(task* first, task* last) {
+        origin_.push_bulk(first, last);
+    }
+
     bool try_pop(task& t) {
         return origin_.try_pop(t);
     }
 
+    /**
+     * @brief visit the queued tasks without consuming them
+     * @details the elements stay queued (or are restored, depending on the backing queue).
+     * Not thread-safe - intended for diagnostics where best-effort accuracy suffices.
+     */
+    template <class F>
+    void visit(F&& visitor) {
+        origin_.visit(std::forward<F>(visitor));
+    }
+
     [[nodiscard]] std::size_t size() const {
         return origin_.size();
     }
@@ -95,4 +113,23 @@ private:
     queue_type origin_{};
 };
 
+/**
+ * @brief the pair of task queues owned by a single worker
+ * @details the local and sticky queue of one worker are co-located in a single cache-line-aligned
+ * object so that selecting either queue for a given worker index touches adjacent cache lines,
+ * while the queue pairs of different workers never share a line.
+ */
+template <class T>
+struct alignas(hardware_destructive_interference_size) worker_queues {
+    /**
+     * @brief the local task queue
+     */
+    basic_queue<T> local{};  //NOLINT(misc-non-private-member-variables-in-classes)
+
+    /**
+     * @brief the sticky task queue
+     */
+    basic_queue<T> sticky{};  //NOLINT(misc-non-private-member-variables-in-classes)
+};
+
 }
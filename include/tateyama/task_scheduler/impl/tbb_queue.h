@@ -45,10 +45,32 @@ public:
         origin_.push(std::move(t));
     }
 
+    /**
+     * @brief push the tasks in [first, last) moving out the elements
+     * @details tbb::concurrent_queue has no bulk api, so this simply amortizes the per-call overhead
+     */
+    void push_bulk(task* first, task* last) {
+        for(auto* it = first; it != last; ++it) {
+            origin_.push(std::move(*it));
+        }
+    }
+
     bool try_pop(task& t) {
         return origin_.try_pop(t);
     }
 
+    /**
+     * @brief visit the queued tasks without consuming them
+     * @details iterates the internal storage via the unsafe iterators, so the elements are neither
+     * popped nor moved. Not thread-safe - intended for diagnostics where best-effort accuracy suffices.
+     */
+    template <class F>
+    void visit(F&& visitor) {
+        for(auto it = origin_.unsafe_begin(), end = origin_.unsafe_end(); it != end; ++it) {
+            visitor(*it);
+        }
+    }
+
     [[nodiscard]] std::size_t size() const {
         return origin_.unsafe_size();
     }
@@ -85,16 +85,14 @@ public:
 
     /**
      * @brief create new object
-     * @param queues reference to the queues
-     * @param sticky_task_queues reference to the sticky task queues
+     * @param queues reference to the per-worker queue pairs (local and sticky)
      * @param initial_tasks reference initial tasks (ones submitted before starting scheduler)
      * @param stat worker stat information
      * @param cfg the scheduler configuration information
      * @param initializer the function called on worker thread for initialization
      */
     worker(
-        std::vector<basic_queue<task>>& queues,
-        std::vector<basic_queue<task>>& sticky_task_queues,
+        std::vector<worker_queues<task>>& queues,
         std::vector<std::vector<task>>& initial_tasks,
         worker_stat& stat,
         task_scheduler_cfg const& cfg,
@@ -102,7 +100,6 @@ public:
     ) noexcept:
         cfg_(std::addressof(cfg)),
         queues_(std::addressof(queues)),
-        sticky_task_queues_(std::addressof(sticky_task_queues)),
         initial_tasks_(std::addressof(initial_tasks)),
         stat_(std::addressof(stat)),
         initializer_(std::move(initializer))
@@ -116,17 +113,22 @@ public:
         // reconstruct the queues so that they are on each numa node
         ctx.thread(info.thread());
         auto index = info.thread_id();
-        (*queues_)[index].reconstruct();
-        (*sticky_task_queues_)[index].reconstruct();
-        auto& q = (*queues_)[index];
-        auto& sq = (*sticky_task_queues_)[index];
+        auto& wq = (*queues_)[index];
+        wq.local.reconstruct();
+        wq.sticky.reconstruct();
+        auto& q = wq.local;
+        auto& sq = wq.sticky;
         auto& s = (*initial_tasks_)[index];
-        for(auto&& t : s) {
-            if(t.sticky()) {
-                sq.push(std::move(t));
-                continue;
+        // flush runs of tasks with the same stickiness in bulk to amortize the queue synchronization
+        auto* it = s.data();
+        auto* end = it + s.size();  //NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        while(it != end) {
+            auto* begin = it;
+            bool sticky = it->sticky();
+            while(it != end && it->sticky() == sticky) {
+                ++it;  //NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
             }
-            q.push(std::move(t));
+            (sticky ? sq : q).push_bulk(begin, it);
         }
         s.clear();
 
@@ -195,8 +197,9 @@ public:
      */
     void operator()(context& ctx) {
         auto index = ctx.index();
-        auto& q = (*queues_)[index];
-        auto& sq = (*sticky_task_queues_)[index];
+        auto& wq = (*queues_)[index];
+        auto& q = wq.local;
+        auto& sq = wq.sticky;
         ctx.last_steal_from(index);
         std::size_t empty_work_count = 0;
         while(sq.active() || q.active()) {
@@ -212,8 +215,7 @@ public:
 
 private:
     task_scheduler_cfg const* cfg_{};
-    std::vector<basic_queue<task>>* queues_{};
-    std::vector<basic_queue<task>>* sticky_task_queues_{};
+    std::vector<worker_queues<task>>* queues_{};
     std::vector<std::vector<task>>* initial_tasks_{};
     worker_stat* stat_{};
     initializer_type initializer_{};
@@ -230,7 +232,7 @@ private:
         std::size_t last = ctx.last_steal_from();
         task t{};
         for(auto idx = next(last); idx != last; idx = next(idx)) {
-            auto& tgt = (*queues_)[idx];
+            auto& tgt = (*queues_)[idx].local;
             if(tgt.active() && tgt.try_pop(t)) {
                 ctx.last_steal_from(idx);
                 ctx.task_is_stolen(true);
@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include <array>
 #include <chrono>
 #include <sched.h>
 
@@ -62,6 +63,11 @@ public:
      */
     using queue = tateyama::task_scheduler::impl::basic_queue<task>;
 
+    /**
+     * @brief per-worker queue pair type (local and sticky queue co-located per worker)
+     */
+    using worker_queues = tateyama::task_scheduler::impl::worker_queues<task>;
+
     /**
      * @brief conditional task queue type
      */
@@ -110,6 +116,8 @@ public:
     explicit scheduler(task_scheduler_cfg cfg = {}, bool empty_thread = false) :
         cfg_(cfg),
         size_(cfg_.thread_count()),
+        use_preferred_worker_for_current_thread_(cfg_.use_preferred_worker_for_current_thread()),
+        busy_worker_(cfg_.busy_worker()),
         empty_thread_(empty_thread)
     {
         prepare();
@@ -166,7 +174,7 @@ public:
             }
         }
         if (! found || opt.policy() == schedule_policy_kind::undefined) {
-            if (cfg_.use_preferred_worker_for_current_thread()) {
+            if (use_preferred_worker_for_current_thread_) {
                 index = preferred_worker_for_current_thread();
             } else {
                 index = next_worker();
@@ -190,18 +198,46 @@ public:
             s.emplace_back(std::move(t));
             return;
         }
-        if(t.sticky()) {
-            auto& q = sticky_task_queues_[index];
-            q.push(std::move(t));
-            if(! cfg_.busy_worker()) {
-                thread.activate();
-            }
+        auto& wq = queues_[index];
+        // select the queue by indexing instead of branching - sticky/normal mixes mispredict badly
+        std::array<queue*, 2> qs{std::addressof(wq.local), std::addressof(wq.sticky)};
+        qs[static_cast<std::size_t>(t.sticky())]->push(std::move(t));  //NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        if(! busy_worker_) {
+            thread.activate();
+        }
+    }
+
+    /**
+     * @brief schedule the tasks in [first, last) on the specified worker
+     * @param first the beginning of the tasks to be scheduled. The tasks are moved out of the range.
+     * @param last the end of the tasks to be scheduled
+     * @param index the preferred worker index for the tasks to execute. Same as schedule_at, stealing may
+     * move the tasks to other workers.
+     * @details bulk version of schedule_at that pays the queue synchronization once per run of tasks with
+     * the same stickiness instead of once per task. The first task may be picked up slightly later than
+     * with per-task submission, but the per-task overhead is much smaller.
+     * @note this function is thread-safe. Multiple threads can safely call this function concurrently.
+     */
+    void schedule_bulk(task* first, task* last, std::size_t index) {
+        BOOST_ASSERT(index < size_); //NOLINT
+        if (! started_) {
+            auto& s = initial_tasks_[index];
+            s.insert(s.end(), std::make_move_iterator(first), std::make_move_iterator(last));
             return;
         }
-        auto& q = queues_[index];
-        q.push(std::move(t));
-        if(! cfg_.busy_worker()) {
-            thread.activate();
+        auto& wq = queues_[index];
+        std::array<queue*, 2> qs{std::addressof(wq.local), std::addressof(wq.sticky)};
+        auto* it = first;
+        while(it != last) {
+            auto* begin = it;
+            bool sticky = it->sticky();
+            while(it != last && it->sticky() == sticky) {
+                ++it;
+            }
+            qs[static_cast<std::size_t>(sticky)]->push_bulk(begin, it);  //NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        }
+        if(first != last && ! busy_worker_) {
+            threads_[index].activate();
         }
     }
 
@@ -234,11 +270,9 @@ public:
      * @note this function is *NOT* thread-safe. Only a thread must call this when finishing using the scheduler.
      */
     void stop() {
-        for(auto&& q : queues_) {
-            q.deactivate();
-        }
-        for(auto&& q : sticky_task_queues_) {
-            q.deactivate();
+        for(auto&& wq : queues_) {
+            wq.local.deactivate();
+            wq.sticky.deactivate();
         }
         conditional_queue_.deactivate();
         if(watcher_thread_) {
@@ -263,31 +297,24 @@ public:
      * @brief accessor to the worker statistics
      * @note this function is thread-safe. Multiple threads can safely call this function concurrently.
      */
-    [[nodiscard]] std::vector<tateyama::task_scheduler::impl::worker_stat> const& worker_stats() const noexcept {
+    [[nodiscard]] std::vector<cache_line_storage<tateyama::task_scheduler::impl::worker_stat>> const& worker_stats() const noexcept {
         return worker_stats_;
     }
 
     /**
      * @brief accessor to the contexts for testing purpose
      */
-    [[nodiscard]] std::vector<context>& contexts() noexcept {
+    [[nodiscard]] std::vector<cache_line_storage<context>>& contexts() noexcept {
         return contexts_;
     }
 
     /**
-     * @brief accessor to the local queue for testing purpose
+     * @brief accessor to the per-worker queue pairs for testing purpose
      */
-    [[nodiscard]] std::vector<queue>& queues() noexcept {
+    [[nodiscard]] std::vector<worker_queues>& queues() noexcept {
         return queues_;
     }
 
-    /**
-     * @brief accessor to the sticky task queue for testing purpose
-     */
-    [[nodiscard]] std::vector<queue>& sticky_task_queues() noexcept {
-        return sticky_task_queues_;
-    }
-
     /**
      * @brief accessor to the workers for testing purpose
      * @return the workers list
@@ -337,9 +364,9 @@ public:
             threads_[i].print_diagnostic(os);
             os << "    queues:" << std::endl;
             os << "      local:" << std::endl;
-            print_queue_diagnostic(queues_[i], os);
+            print_queue_diagnostic(queues_[i].local, os);
             os << "      sticky:" << std::endl;
-            print_queue_diagnostic(sticky_task_queues_[i], os);
+            print_queue_diagnostic(queues_[i].sticky, os);
         }
         // TODO fix indent for conditional
         os << "conditional_worker:" << std::endl;
@@ -364,7 +391,7 @@ public:
         os << "\"worker_count\":" << count << ",";
         os << "\"workers\":[";
         for(std::size_t i=0; i < count; ++i) {
-            auto& stat = worker_stats_[i];
+            auto& stat = worker_stats_[i].data;
             if(i != 0) {
                 os << ",";
             }
@@ -383,12 +410,17 @@ public:
 private:
     task_scheduler_cfg cfg_{};
     std::size_t size_{};
-    std::vector<queue> queues_{};
-    std::vector<queue> sticky_task_queues_{};
+    // cfg_ never changes after construction, so the flags read on every schedule call are
+    // snapshot here to save the accessor indirection on the hot path
+    bool use_preferred_worker_for_current_thread_{};
+    bool busy_worker_{};
+    // per-worker mutable state is wrapped in cache_line_storage so that adjacent workers
+    // never share a cache line even though the vectors lay elements out contiguously
+    std::vector<worker_queues> queues_{};
     std::vector<worker> workers_{};  // stored for testing
     std::vector<impl::thread_control> threads_{};
-    std::vector<impl::worker_stat> worker_stats_{};
-    std::vector<context> contexts_{};
+    std::vector<cache_line_storage<impl::worker_stat>> worker_stats_{};
+    std::vector<cache_line_storage<context>> contexts_{};
     std::atomic_size_t current_index_{};
     std::vector<std::vector<task>> initial_tasks_{};
     std::atomic_bool started_{false};
@@ -399,24 +431,31 @@ private:
     impl::conditional_worker_context conditional_worker_context_{};
     conditional_worker conditional_worker_{}; // stored for testing
     clock::time_point started_at_{};
+    // worker count - 1 if the count is a power of two, otherwise `undefined` to fall back to modulo
+    std::size_t index_mask_{undefined};
 
     void prepare() {
         auto sz = cfg_.thread_count();
+        if (sz != 0 && (sz & (sz - 1)) == 0) {
+            index_mask_ = sz - 1;
+        }
         queues_.resize(sz);
-        sticky_task_queues_.resize(sz);
         worker_stats_.resize(sz);
         initial_tasks_.resize(sz);
+        for(auto&& v : initial_tasks_) {
+            v.reserve(cfg_.initial_task_hint());
+        }
         contexts_.reserve(sz);
         workers_.reserve(sz);
         threads_.reserve(sz);
         for(std::size_t i = 0; i < sz; ++i) {
-            auto& ctx = contexts_.emplace_back(i);
+            auto& ctx = contexts_.emplace_back(cache_line_storage<context>{context{i}}).data;
             ctx.local_first_notifer().init(
                 static_cast<std::size_t>(cfg_.ratio_check_local_first().numerator()),
                 static_cast<std::size_t>(cfg_.ratio_check_local_first().denominator())
             );
             auto& worker = workers_.emplace_back(
-                queues_, sticky_task_queues_, initial_tasks_, worker_stats_[i], cfg_, [this](std::size_t index) {
+                queues_, initial_tasks_, worker_stats_[i].data, cfg_, [this](std::size_t index) {
                         this->initialize_preferred_worker_for_current_thread(index);
                 });
             if (! empty_thread_) {
@@ -437,6 +476,11 @@ private:
     template<class E>
     std::size_t increment(E& index, std::size_t mod) {
         auto ret = index++;
+        // integer division is expensive on the scheduling hot path - use the mask when the
+        // worker count is a power of two (size_ is fixed after construction)
+        if (index_mask_ != undefined) {
+            return ret & index_mask_;
+        }
         return ret % mod;
     }
 
@@ -450,31 +494,37 @@ private:
             return;
         }
         os << "        tasks:" << std::endl;
-        Queue backup{};
-        typename Queue::task t{};
-        while(q.try_pop(t)) {
+        q.visit([&os](auto& t) {
             print_task_diagnostic(t, os);
-            backup.push(std::move(t));
-        }
-        while(backup.try_pop(t)) {
-            q.push(std::move(t));
-        }
+        });
     }
 
     constexpr static auto undefined = static_cast<std::size_t>(-1);
 
     std::size_t set_preferred_worker_for_current_thread(std::size_t index = undefined) {
+#ifdef INITIAL_EXEC_TLS
+        // initial-exec avoids the __tls_get_addr call on every access, but must not be used
+        // when this library is loaded via dlopen (keep the flag off for plugin builds)
+        thread_local std::size_t index_for_this_thread __attribute__((tls_model("initial-exec"))) = undefined;  //NOLINT
+#else
         thread_local std::size_t index_for_this_thread = undefined;
+#endif
         if (index != undefined) {
             index_for_this_thread = index;
-            return index_for_this_thread;
+            return index;
         }
-        if (index_for_this_thread == undefined) {
-            index_for_this_thread = next_worker();
+        // hoist the thread local into a register-resident local so the TLS address is resolved once
+        auto v = index_for_this_thread;
+        if (v == undefined) {
+            v = next_worker();
+            index_for_this_thread = v;
             // using VLOG since caller threads are frequently re-created and this message is displayed often
-            VLOG_LP(log_debug) << "worker " << index_for_this_thread << " assigned for thread on core " << sched_getcpu();
+            // guard explicitly so sched_getcpu() is never issued when the vlog level filters the message
+            if (VLOG_IS_ON(log_debug)) {
+                VLOG_LP(log_debug) << "worker " << v << " assigned for thread on core " << sched_getcpu();
+            }
         }
-        return index_for_this_thread;
+        return v;
     }
 
     void ensure_stopping_thread(impl::thread_control& th) {
@@ -179,6 +179,19 @@ public:
         worker_suspend_timeout_ = arg;
     }
 
+    /**
+     * @brief accessor for initial task hint
+     * @return the expected number of tasks scheduled per worker before the scheduler starts
+     * @details used to reserve the initial task storage so that pre-start scheduling doesn't reallocate
+     */
+    [[nodiscard]] std::size_t initial_task_hint() const noexcept {
+        return initial_task_hint_;
+    }
+
+    void initial_task_hint(std::size_t arg) noexcept {
+        initial_task_hint_ = arg;
+    }
+
     friend inline std::ostream& operator<<(std::ostream& out, task_scheduler_cfg const& cfg) {
         return out << std::boolalpha <<
             "thread_count:" << cfg.thread_count() << " " <<
@@ -195,6 +208,7 @@ public:
             "watcher_interval:" << cfg.watcher_interval() << " " <<
             "worker_try_count:" << cfg.worker_try_count() << " " <<
             "worker_suspend_timeout:" << cfg.worker_suspend_timeout() << " " <<
+            "initial_task_hint:" << cfg.initial_task_hint() << " " <<
             "";
     }
 
@@ -213,6 +227,7 @@ private:
     std::size_t watcher_interval_ = 1000;
     std::size_t worker_try_count_ = 1000;
     std::size_t worker_suspend_timeout_ = 1000000;
+    std::size_t initial_task_hint_ = 64;
 };
 
 }
@@ -24,6 +24,23 @@ namespace tateyama {
 // replace with std one when C++17 becomes available
 static constexpr std::size_t hardware_destructive_interference_size = 64;
 
+/**
+ * @brief storage wrapper to place the element on its own cache line
+ * @details used for contiguous containers (e.g. std::vector) whose elements are written from different threads,
+ * so that neighboring elements never share a cache line and writes by one thread don't invalidate others' lines.
+ * @tparam T the element type
+ */
+template <class T>
+struct alignas(hardware_destructive_interference_size) cache_line_storage {
+    /**
+     * @brief the wrapped element
+     */
+    T data;  //NOLINT(misc-non-private-member-variables-in-classes)
+};
+
+static_assert(sizeof(cache_line_storage<char>) == hardware_destructive_interference_size);
+static_assert(alignof(cache_line_storage<char>) == hardware_destructive_interference_size);
+
 }
 
 /**
@@ -15,10 +15,14 @@
  */
 #include <tateyama/datastore/service/core.h>
 
+#include <array>
+
 #include <tateyama/api/configuration.h>
 #include <tateyama/framework/component_ids.h>
 #include <tateyama/framework/service.h>
 
+#include <google/protobuf/arena.h>
+
 #include <tateyama/proto/datastore/request.pb.h>
 #include <tateyama/proto/datastore/response.pb.h>
 #ifdef ENABLE_ALTIMETER
@@ -31,275 +35,311 @@ namespace tateyama::datastore::service {
 using tateyama::api::server::request;
 using tateyama::api::server::response;
 
-bool tateyama::datastore::service::core::operator()(const std::shared_ptr<request>& req, const std::shared_ptr<response>& res) {
-    namespace ns = tateyama::proto::datastore::request;
+namespace ns = tateyama::proto::datastore::request;
+
+namespace {
+
+constexpr auto this_request_does_not_use_session_id = static_cast<std::size_t>(-2);
 
-    constexpr static auto this_request_does_not_use_session_id = static_cast<std::size_t>(-2);
+} // namespace
+
+bool tateyama::datastore::service::core::operator()(const std::shared_ptr<request>& req, const std::shared_ptr<response>& res) {
+    // dispatch table indexed by command_case - one indirect call per request instead of a
+    // switch over the oneof tag; entries without a handler are accepted and ignored as before
+    static constexpr auto dispatch = [] {
+        std::array<command_handler, ns::Request::kRestoreDispose + 1> table{};
+        table[ns::Request::kBackupBegin] = &core::handle_backup_begin;
+        table[ns::Request::kBackupDetailBegin] = &core::handle_backup_detail_begin;
+        table[ns::Request::kBackupEnd] = &core::handle_backup_end;
+        table[ns::Request::kBackupEstimate] = &core::handle_backup_estimate;
+        table[ns::Request::kRestoreBegin] = &core::handle_restore_begin;
+        return table;
+    }();
 
     auto data = req->payload();
-    ns::Request rq{};
-    if(!rq.ParseFromArray(data.data(), static_cast<int>(data.size()))) {
+    // allocate the request and response messages (and their nested fields) from one arena so the
+    // whole exchange costs a few bump allocations instead of per-message/per-field heap traffic
+    google::protobuf::Arena arena{};
+    auto* rq = google::protobuf::Arena::CreateMessage<ns::Request>(&arena);
+    // string fields parsed into an arena message land in arena storage - open-source protobuf
+    // offers no input-side aliasing, so this is as close to copy-free parsing as the api allows
+    if(!rq->ParseFromArray(data.data(), static_cast<int>(data.size()))) {
         LOG(ERROR) << "request parse error";
         return false;
     }
 
-    DVLOG(log_debug) << "request is no. " << rq.command_case();
-    switch(rq.command_case()) {
-        case ns::Request::kBackupBegin: {
-            backup_id_++;
-            backup_ = std::make_unique<limestone_backup>(resource_->begin_backup());
+    DVLOG(log_debug) << "request is no. " << rq->command_case();
+    if (auto cmd = static_cast<std::size_t>(rq->command_case()); cmd < dispatch.size()) {
+        if (auto handler = dispatch.at(cmd); handler != nullptr) {
+            return (this->*handler)(*rq, req, res, arena);
+        }
+    }
+    return true;
+}
+
+bool core::handle_backup_begin(ns::Request const&,
+        const std::shared_ptr<request>& req, const std::shared_ptr<response>& res,
+        google::protobuf::Arena& arena) {
+    // the response cannot be cached across calls: begin_backup() opens a fresh backup session
+    // whose file set may differ, the reply carries a new backup id, and limestone exposes no
+    // mutation version to key a cache on; arena allocation and the reservations below keep the
+    // rebuild cost to the unavoidable minimum instead
+    backup_id_++;
+    backup_ = std::make_unique<limestone_backup>(resource_->begin_backup());
 #ifdef ENABLE_ALTIMETER
-            service::backup(req, "all", backup_restore_success);
+    service::backup(req, "all", backup_restore_success);
 #endif
 
-            tateyama::proto::datastore::response::BackupBegin rp{};
-            auto success = rp.mutable_success();
-            success->set_id(backup_id_);
-            auto simple_source = success->mutable_simple_source();
-            for(auto&& f : backup_->backup().files()) {
-                simple_source->add_files(f.string());
-            }
-            res->session_id(req->session_id());
-            auto body = rp.SerializeAsString();
-            res->body(body);
-            rp.clear_success();
-            break;
-        }
-        case ns::Request::kBackupDetailBegin: {
-            auto& rb = rq.backup_detail_begin();
-            auto type = (rb.type() == ns::BackupType::STANDARD) ?
-                limestone::api::backup_type::standard :
-                limestone::api::backup_type::transaction;
-            backup_detail_ = resource_->begin_backup(type);
+    auto* rp = google::protobuf::Arena::CreateMessage<tateyama::proto::datastore::response::BackupBegin>(&arena);
+    auto success = rp->mutable_success();
+    success->set_id(backup_id_);
+    auto simple_source = success->mutable_simple_source();
+    auto& files = backup_->backup().files();
+    // reserve up front - the backing array of the repeated field doubles on growth otherwise
+    simple_source->mutable_files()->Reserve(static_cast<int>(files.size()));
+    for(auto&& f : files) {
+        simple_source->add_files(f.string());
+    }
+    res->session_id(req->session_id());
+    // size the buffer exactly up front - ByteSizeLong is cached and reused by the serializer
+    std::string body{};
+    body.reserve(rp->ByteSizeLong());
+    rp->AppendToString(&body);
+    res->body(std::move(body));
+    return true;
+}
+
+bool core::handle_backup_detail_begin(ns::Request const& rq,
+        const std::shared_ptr<request>& req, const std::shared_ptr<response>& res,
+        google::protobuf::Arena& arena) {
+    auto& rb = rq.backup_detail_begin();
+    auto type = (rb.type() == ns::BackupType::STANDARD) ?
+        limestone::api::backup_type::standard :
+        limestone::api::backup_type::transaction;
+    backup_detail_ = resource_->begin_backup(type);
 #ifdef ENABLE_ALTIMETER
-            service::backup(req,
-                    type == limestone::api::backup_type::standard ? "standard" : "transaction",
-                    backup_restore_success);
+    service::backup(req,
+            type == limestone::api::backup_type::standard ? "standard" : "transaction",
+            backup_restore_success);
 #endif
 
-            tateyama::proto::datastore::response::BackupBegin rp{};
-            auto success = rp.mutable_success();
-            success->set_id(backup_id_);
-            auto detail_source = success->mutable_detail_source();
-            detail_source->set_log_begin(backup_detail_->log_start());
-            detail_source->set_log_end(backup_detail_->log_finish());
-            if (auto image_finish = backup_detail_->image_finish(); image_finish) {
-                detail_source->set_image_finish_value(image_finish.value());
-            } else {
-                detail_source->set_image_finish_is_not_set(0);
-            }
-            auto entries = detail_source->mutable_detail_files();
-            for (auto&& e : backup_detail_->entries()) {
-                auto* entry = entries->Add();
-                entry->set_source(e.source_path().string());
-                entry->set_destination(e.destination_path().string());
-                entry->set_mutable_(e.is_mutable());
-                entry->set_detached(e.is_detached());
-            }
-            res->session_id(req->session_id());
-            auto body = rp.SerializeAsString();
-            res->body(body);
-            success->clear_detail_source();
-            rp.clear_success();
-            break;
-        }
-        case ns::Request::kBackupEnd: {
-            tateyama::proto::datastore::response::BackupEnd rp{};
-            if (backup_ || backup_detail_) {
-                rp.mutable_success();
-                res->session_id(req->session_id());
-                auto body = rp.SerializeAsString();
-                res->body(body);
-                rp.clear_success();
-                backup_ = nullptr;
-            } else {
-                rp.mutable_expired();
-            }
-            break;
-        }
-#if 0
-        case ns::Request::kBackupContine: {
-            tateyama::proto::datastore::response::BackupContinue rp{};
-            rp.mutable_success();
-            res->session_id(req->session_id());
-            auto body = rp.SerializeAsString();
-            res->body(body);
-            rp.clear_success();
-            break;
-        }
-#endif
-        case ns::Request::kBackupEstimate: {
-            tateyama::proto::datastore::response::BackupEstimate rp{};
-            auto success = rp.mutable_success();
-            success->set_number_of_files(123);
-            success->set_number_of_bytes(456);
-            res->session_id(this_request_does_not_use_session_id);
-            auto body = rp.SerializeAsString();
-            res->body(body);
-            rp.clear_success();
-            break;
-        }
-        case ns::Request::kRestoreBegin: {
-            auto& rb = rq.restore_begin();
-            tateyama::proto::datastore::response::RestoreBegin rp{};
-            limestone::status rc{};
+    auto* rp = google::protobuf::Arena::CreateMessage<tateyama::proto::datastore::response::BackupBegin>(&arena);
+    auto success = rp->mutable_success();
+    success->set_id(backup_id_);
+    auto detail_source = success->mutable_detail_source();
+    detail_source->set_log_begin(backup_detail_->log_start());
+    detail_source->set_log_end(backup_detail_->log_finish());
+    if (auto image_finish = backup_detail_->image_finish(); image_finish) {
+        detail_source->set_image_finish_value(image_finish.value());
+    } else {
+        detail_source->set_image_finish_is_not_set(0);
+    }
+    auto entries = detail_source->mutable_detail_files();
+    for (auto&& e : backup_detail_->entries()) {
+        auto* entry = entries->Add();
+        entry->set_source(e.source_path().string());
+        entry->set_destination(e.destination_path().string());
+        entry->set_mutable_(e.is_mutable());
+        entry->set_detached(e.is_detached());
+    }
+    res->session_id(req->session_id());
+    std::string body{};
+    body.reserve(rp->ByteSizeLong());
+    rp->AppendToString(&body);
+    res->body(std::move(body));
+    return true;
+}
+
+bool core::handle_backup_end(ns::Request const&,
+        const std::shared_ptr<request>& req, const std::shared_ptr<response>& res,
+        google::protobuf::Arena& arena) {
+    auto* rp = google::protobuf::Arena::CreateMessage<tateyama::proto::datastore::response::BackupEnd>(&arena);
+    if (backup_ || backup_detail_) {
+        rp->mutable_success();
+        res->session_id(req->session_id());
+        std::string body{};
+        body.reserve(rp->ByteSizeLong());
+        rp->AppendToString(&body);
+        res->body(std::move(body));
+        backup_ = nullptr;
+    } else {
+        rp->mutable_expired();
+    }
+    return true;
+}
+
+bool core::handle_backup_estimate(ns::Request const&,
+        const std::shared_ptr<request>&, const std::shared_ptr<response>& res,
+        google::protobuf::Arena&) {
+    // the reply is constant, so serialize it once and reuse the wire bytes on every request
+    static std::string const body = [] {
+        tateyama::proto::datastore::response::BackupEstimate rp{};
+        auto success = rp.mutable_success();
+        success->set_number_of_files(123);
+        success->set_number_of_bytes(456);
+        return rp.SerializeAsString();
+    }();
+    res->session_id(this_request_does_not_use_session_id);
+    res->body(body);
+    return true;
+}
+
+bool core::handle_restore_begin(ns::Request const& rq,
+        [[maybe_unused]] const std::shared_ptr<request>& req, const std::shared_ptr<response>& res,
+        google::protobuf::Arena& arena) {
+    auto& rb = rq.restore_begin();
+    auto* rp = google::protobuf::Arena::CreateMessage<tateyama::proto::datastore::response::RestoreBegin>(&arena);
+    limestone::status rc{};
 #ifdef ENABLE_ALTIMETER
-            std::string command{};
+    std::string command{};
 #endif
-            switch (rb.source_case()) {
-            case ns::RestoreBegin::kBackupDirectory:
-                rc = resource_->restore_backup(rb.backup_directory(), rb.keep_backup());
+    switch (rb.source_case()) {
+    case ns::RestoreBegin::kBackupDirectory:
+        rc = resource_->restore_backup(rb.backup_directory(), rb.keep_backup());
 #ifdef ENABLE_ALTIMETER
-                command = "directory " + rb.backup_directory();
+        command = "directory " + rb.backup_directory();
 #endif
-                break;
-            case ns::RestoreBegin::kTagName:
-                LOG(ERROR) << "restore tag is not implemented";
-                break;
-            case ns::RestoreBegin::kEntries:
-            {
-                std::vector<limestone::api::file_set_entry> entries{};
-                for (auto&& f: rb.entries().file_set_entry()) {
-                    entries.emplace_back(limestone::api::file_set_entry(
-                                             boost::filesystem::path(f.source_path()),
-                                             boost::filesystem::path(f.destination_path()),
-                                             f.detached()
-                                         )
-                    );
-                }
-                rc = resource_->restore_backup(rb.entries().directory(), entries);
+        break;
+    case ns::RestoreBegin::kTagName:
+        LOG(ERROR) << "restore tag is not implemented";
+        break;
+    case ns::RestoreBegin::kEntries:
+    {
+        std::vector<limestone::api::file_set_entry> entries{};
+        for (auto&& f: rb.entries().file_set_entry()) {
+            entries.emplace_back(limestone::api::file_set_entry(
+                                     boost::filesystem::path(f.source_path()),
+                                     boost::filesystem::path(f.destination_path()),
+                                     f.detached()
+                                 )
+            );
+        }
+        rc = resource_->restore_backup(rb.entries().directory(), entries);
 #ifdef ENABLE_ALTIMETER
-                command = "entries " + rb.entries().directory();
+        command = "entries " + rb.entries().directory();
 #endif
-                break;
-            }
-            default:
-                LOG(ERROR) << "source is not specified";
-                break;
-            }
-            switch (rc) {
-            case limestone::status::ok:
-                rp.mutable_success();
-                break;
-            case limestone::status::err_not_found:
-                rp.mutable_not_found();
-                break;
-            case limestone::status::err_permission_error:
-                rp.mutable_permission_error();
-                break;
-            case limestone::status::err_broken_data:
-                rp.mutable_broken_data();
-                break;
-            default:
-                rp.mutable_unknown_error();
-                break;
-            }
+        break;
+    }
+    default:
+        LOG(ERROR) << "source is not specified";
+        break;
+    }
+    switch (rc) {
+    case limestone::status::ok:
+        rp->mutable_success();
+        break;
+    case limestone::status::err_not_found:
+        rp->mutable_not_found();
+        break;
+    case limestone::status::err_permission_error:
+        rp->mutable_permission_error();
+        break;
+    case limestone::status::err_broken_data:
+        rp->mutable_broken_data();
+        break;
+    default:
+        rp->mutable_unknown_error();
+        break;
+    }
 #ifdef ENABLE_ALTIMETER
-            service::restore(req, command,
-                    rc == limestone::status::ok ? backup_restore_success : backup_restore_fail);
+    service::restore(req, command,
+            rc == limestone::status::ok ? backup_restore_success : backup_restore_fail);
 #endif
-            res->session_id(this_request_does_not_use_session_id);
-            auto body = rp.SerializeAsString();
-            res->body(body);
-            rp.clear_success();
-            break;
-        }
+    res->session_id(this_request_does_not_use_session_id);
+    std::string body{};
+    body.reserve(rp->ByteSizeLong());
+    rp->AppendToString(&body);
+    res->body(std::move(body));
+    return true;
+}
 
 #if 0
-        case ns::Request::kTagList: {
-            auto tags = resource_->list_tags();
-            tateyama::proto::datastore::response::TagList rp{};
-            auto success = rp.mutable_success();
-            auto t = success->mutable_tags();
-            for(auto&& tag : tags) {
-                t->Add()->set_name(tag);
-            }
-            res->session_id(req->session_id());
-            auto body = rp.SerializeAsString();
-            res->body(body);
-            success->clear_tags();
-            rp.clear_success();
-            break;
-        }
-        case ns::Request::kTagAdd: {
-            auto& ta = rq.tag_add();
-            auto info = resource_->add_tag(ta.name(), ta.comment());
-            tateyama::proto::datastore::response::TagAdd rp{};
-            auto success = rp.mutable_success();
-            auto t = success->mutable_tag();
-            t->set_name(info.name_);
-            t->set_comment(info.comment_);
-            t->set_author(info.author_);
-            t->set_timestamp(info.timestamp_);
-            res->session_id(req->session_id());
-            auto body = rp.SerializeAsString();
-            res->body(body);
-            success->clear_tag();
-            rp.clear_success();
-            break;
-        }
-        case ns::Request::kTagGet: {
-            auto& tg = rq.tag_get();
-            resource::tag_info info{};
-            auto found = resource_->get_tag(tg.name(), info);
-            tateyama::proto::datastore::response::TagGet rp{};
-            if(found) {
-                auto success = rp.mutable_success();
-                auto t = success->mutable_tag();
-                t->set_name(info.name_);
-                t->set_comment(info.comment_);
-                t->set_author(info.author_);
-                t->set_timestamp(info.timestamp_);
-                res->session_id(req->session_id());
-                auto body = rp.SerializeAsString();
-                res->body(body);
-                success->clear_tag();
-                rp.clear_success();
-            } else {
-                auto not_found = rp.mutable_not_found();
-                not_found->set_name(tg.name());
-                res->session_id(req->session_id());
-                auto body = rp.SerializeAsString();
-                res->body(body);
-                rp.clear_not_found();
-            }
-            break;
-        }
-        case ns::Request::kTagRemove: {
-            auto& tr = rq.tag_remove();
-            auto found = resource_->remove_tag(tr.name());
-            tateyama::proto::datastore::response::TagRemove rp{};
-            if(found) {
-                auto success = rp.mutable_success();
-                success->set_name(tr.name());
-                res->session_id(req->session_id());
-                auto body = rp.SerializeAsString();
-                res->body(body);
-                rp.clear_success();
-            } else {
-                auto not_found = rp.mutable_not_found();
-                not_found->set_name(tr.name());
-                res->session_id(req->session_id());
-                auto body = rp.SerializeAsString();
-                res->body(body);
-                rp.clear_not_found();
-            }
-            break;
-        }
-#else
-    case ns::Request::kTagList:
-    case ns::Request::kTagAdd:
-    case ns::Request::kTagGet:
-    case ns::Request::kTagRemove:
-#endif
-    case ns::Request::kRestoreStatus:
-    case ns::Request::kRestoreCancel:
-    case ns::Request::kRestoreDispose:
-        break;
-        case ns::Request::COMMAND_NOT_SET: break;
+// disabled commands kept for reference; when revived, register them in the dispatch table above
+bool core::handle_backup_continue(...) {
+    tateyama::proto::datastore::response::BackupContinue rp{};
+    rp.mutable_success();
+    res->session_id(req->session_id());
+    auto body = rp.SerializeAsString();
+    res->body(body);
+    rp.clear_success();
+}
+bool core::handle_tag_list(...) {
+    auto tags = resource_->list_tags();
+    tateyama::proto::datastore::response::TagList rp{};
+    auto success = rp.mutable_success();
+    auto t = success->mutable_tags();
+    for(auto&& tag : tags) {
+        t->Add()->set_name(tag);
+    }
+    res->session_id(req->session_id());
+    auto body = rp.SerializeAsString();
+    res->body(body);
+    success->clear_tags();
+    rp.clear_success();
+}
+bool core::handle_tag_add(...) {
+    auto& ta = rq.tag_add();
+    auto info = resource_->add_tag(ta.name(), ta.comment());
+    tateyama::proto::datastore::response::TagAdd rp{};
+    auto success = rp.mutable_success();
+    auto t = success->mutable_tag();
+    t->set_name(info.name_);
+    t->set_comment(info.comment_);
+    t->set_author(info.author_);
+    t->set_timestamp(info.timestamp_);
+    res->session_id(req->session_id());
+    auto body = rp.SerializeAsString();
+    res->body(body);
+    success->clear_tag();
+    rp.clear_success();
+}
+bool core::handle_tag_get(...) {
+    auto& tg = rq.tag_get();
+    resource::tag_info info{};
+    auto found = resource_->get_tag(tg.name(), info);
+    tateyama::proto::datastore::response::TagGet rp{};
+    if(found) {
+        auto success = rp.mutable_success();
+        auto t = success->mutable_tag();
+        t->set_name(info.name_);
+        t->set_comment(info.comment_);
+        t->set_author(info.author_);
+        t->set_timestamp(info.timestamp_);
+        res->session_id(req->session_id());
+        auto body = rp.SerializeAsString();
+        res->body(body);
+        success->clear_tag();
+        rp.clear_success();
+    } else {
+        auto not_found = rp.mutable_not_found();
+        not_found->set_name(tg.name());
+        res->session_id(req->session_id());
+        auto body = rp.SerializeAsString();
+        res->body(body);
+        rp.clear_not_found();
+    }
+}
+bool core::handle_tag_remove(...) {
+    auto& tr = rq.tag_remove();
+    auto found = resource_->remove_tag(tr.name());
+    tateyama::proto::datastore::response::TagRemove rp{};
+    if(found) {
+        auto success = rp.mutable_success();
+        success->set_name(tr.name());
+        res->session_id(req->session_id());
+        auto body = rp.SerializeAsString();
+        res->body(body);
+        rp.clear_success();
+    } else {
+        auto not_found = rp.mutable_not_found();
+        not_found->set_name(tr.name());
+        res->session_id(req->session_id());
+        auto body = rp.SerializeAsString();
+        res->body(body);
+        rp.clear_not_found();
     }
-    return true;
 }
+#endif
 
 core::core(std::shared_ptr<tateyama::api::configuration::whole> cfg) :
     cfg_(std::move(cfg))
@@ -52,7 +52,7 @@ service::~service() {
 }
 
 static void reply(google::protobuf::Message &message,
-                  std::shared_ptr<tateyama::api::server::response> &res) {
+                  std::shared_ptr<tateyama::api::server::response> const &res) {
     std::string s { };
     if (!message.SerializeToString(&s)) {
         throw_exception(std::logic_error{"SerializeToOstream failed"});
@@ -61,20 +61,20 @@ static void reply(google::protobuf::Message &message,
 }
 
 static void reply_error(std::string_view error_message,
-                  std::shared_ptr<tateyama::api::server::response> &res) {
+                  std::shared_ptr<tateyama::api::server::response> const &res) {
     tateyama::proto::debug::response::Logging logging { };
     logging.mutable_unknown_error()->set_message(std::string(error_message));
     reply(logging, res);
 }
 
-static void success_logging(std::shared_ptr<tateyama::api::server::response> &res) {
+static void success_logging(std::shared_ptr<tateyama::api::server::response> const &res) {
     tateyama::proto::debug::response::Logging logging { };
     (void) logging.mutable_success();
     reply(logging, res);
 }
 
 static void command_logging(tateyama::proto::debug::request::Request &proto_req,
-                          std::shared_ptr<response> &res) {
+                          std::shared_ptr<response> const &res) {
     const auto &logging = proto_req.logging();
     const auto &message = logging.message();
     switch (logging.level()) {
@@ -94,7 +94,7 @@ static void command_logging(tateyama::proto::debug::request::Request &proto_req,
     success_logging(res);
 }
 
-bool service::operator()(std::shared_ptr<request> req, std::shared_ptr<response> res) {
+bool service::operator()(std::shared_ptr<request> const& req, std::shared_ptr<response> const& res) {
     tateyama::proto::debug::request::Request proto_req { };
     res->session_id(req->session_id());
     auto s = req->payload();
@@ -61,4 +61,24 @@ inline bool append_response_header(std::stringstream& ss, std::string_view body,
     return true;
 }
 
+/**
+ * @brief serialize the framework header and body into one exactly-sized string
+ * @details unlike the stringstream overload, the result needs no str() materialization, so large
+ * bodies are copied once into the output instead of twice through stream buffers
+ */
+inline bool append_response_header(std::string& out, std::string_view body, header_content input, ::tateyama::proto::framework::response::Header::PayloadType type = ::tateyama::proto::framework::response::Header::UNKNOWN) {
+    ::tateyama::proto::framework::response::Header hdr{};
+    hdr.set_session_id(input.session_id_);
+    hdr.set_payload_type(type);
+    auto header_size = hdr.ByteSizeLong();
+    out.reserve(out.size()
+        + google::protobuf::io::CodedOutputStream::VarintSize64(header_size) + header_size
+        + google::protobuf::io::CodedOutputStream::VarintSize64(body.size()) + body.size());
+    google::protobuf::io::StringOutputStream stream{std::addressof(out)};
+    if(auto res = utils::SerializeDelimitedToZeroCopyStream(hdr, std::addressof(stream)); ! res) {
+        return false;
+    }
+    return utils::PutDelimitedBodyToZeroCopyStream(body, std::addressof(stream));
+}
+
 }  // tateyama::endpoint::ipc
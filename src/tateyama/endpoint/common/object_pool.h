@@ -0,0 +1,161 @@
+/*
+ * Copyright 2018-2024 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace tateyama::endpoint::common {
+
+/**
+ * @brief pool recycling the allocations backing shared_ptr-managed objects
+ * @details make_shared() fuses the object and its control block into one allocation just as
+ * std::make_shared does, but when the last reference drops the allocation goes back onto a
+ * free list instead of to the global allocator, so steady-state message handling costs a
+ * list pop and push rather than a malloc and free. The free list keeps the pool storage
+ * alive through the allocator copies held in the control blocks, so pooled objects may
+ * safely outlive the pool object itself.
+ */
+template<class T>
+class object_pool {
+    /**
+     * @brief type-erased cache of free allocations
+     * @details all blocks handed out by one pool have the size and alignment of the fused
+     * object plus control block allocation, which are discovered on first deallocation;
+     * alignment matters here as the pooled types are alignas(64) for cache-line isolation,
+     * above what plain operator new guarantees
+     */
+    class storage {
+    public:
+        explicit storage(std::size_t limit) : limit_(limit) {}
+        ~storage() {
+            for (auto&& e : blocks_) {
+                aligned_delete(e, block_align_);
+            }
+        }
+
+        storage(storage const&) = delete;
+        storage(storage&&) = delete;
+        storage& operator = (storage const&) = delete;
+        storage& operator = (storage&&) = delete;
+
+        void* allocate(std::size_t bytes, std::size_t align) {
+            {
+                std::unique_lock<std::mutex> lock(mtx_);
+                if (!blocks_.empty() && bytes == block_size_ && align == block_align_) {
+                    auto* block = blocks_.back();
+                    blocks_.pop_back();
+                    return block;
+                }
+            }
+            return aligned_new(bytes, align);
+        }
+        void deallocate(void* block, std::size_t bytes, std::size_t align) {
+            {
+                std::unique_lock<std::mutex> lock(mtx_);
+                if ((block_size_ == 0 || (bytes == block_size_ && align == block_align_)) && blocks_.size() < limit_) {
+                    block_size_ = bytes;
+                    block_align_ = align;
+                    blocks_.push_back(block);
+                    return;
+                }
+            }
+            aligned_delete(block, align);
+        }
+
+    private:
+        std::mutex mtx_{};
+        std::vector<void*> blocks_{};
+        std::size_t block_size_{};
+        std::size_t block_align_{};
+        std::size_t limit_;
+
+        static void* aligned_new(std::size_t bytes, std::size_t align) {
+            if (align > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+                return ::operator new(bytes, std::align_val_t{align});
+            }
+            return ::operator new(bytes);
+        }
+        static void aligned_delete(void* block, std::size_t align) noexcept {
+            if (align > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+                ::operator delete(block, std::align_val_t{align});
+                return;
+            }
+            ::operator delete(block);
+        }
+    };
+
+    template<class U>
+    class pool_allocator {
+    public:
+        using value_type = U;
+
+        explicit pool_allocator(std::shared_ptr<storage> pool_storage) noexcept : storage_(std::move(pool_storage)) {}
+        template<class V>
+        pool_allocator(pool_allocator<V> const& other) noexcept : storage_(other.storage_) {}  //NOLINT(google-explicit-constructor)
+
+        U* allocate(std::size_t n) {
+            return static_cast<U*>(storage_->allocate(n * sizeof(U), alignof(U)));
+        }
+        void deallocate(U* p, std::size_t n) {
+            storage_->deallocate(static_cast<void*>(p), n * sizeof(U), alignof(U));
+        }
+        template<class V>
+        bool operator == (pool_allocator<V> const& other) const noexcept {
+            return storage_ == other.storage_;
+        }
+        template<class V>
+        bool operator != (pool_allocator<V> const& other) const noexcept {
+            return !(*this == other);
+        }
+
+    private:
+        std::shared_ptr<storage> storage_;
+
+        template<class V> friend class pool_allocator;
+    };
+
+public:
+    /**
+     * @brief the default maximum number of cached allocations
+     */
+    static constexpr std::size_t default_limit = 16;
+
+    /**
+     * @brief create new object
+     * @param limit the maximum number of free allocations kept for reuse
+     */
+    explicit object_pool(std::size_t limit = default_limit) : storage_(std::make_shared<storage>(limit)) {}
+
+    /**
+     * @brief create a shared_ptr-managed object backed by the pool
+     * @param args the arguments forwarded to the constructor of T
+     * @return the shared_ptr to the object created
+     */
+    template<class... Args>
+    [[nodiscard]] std::shared_ptr<T> make_shared(Args&&... args) {
+        return std::allocate_shared<T>(pool_allocator<T>{storage_}, std::forward<Args>(args)...);
+    }
+
+private:
+    std::shared_ptr<storage> storage_;
+};
+
+}  // tateyama::endpoint::common
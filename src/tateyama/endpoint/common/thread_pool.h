@@ -0,0 +1,102 @@
+/*
+ * Copyright 2018-2024 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace tateyama::endpoint::common {
+
+/**
+ * @brief fixed pool of threads executing posted worker tasks
+ * @details the threads are spawned once at construction, so dispatching a session worker costs a
+ * queue push instead of a clone(2) plus pthread setup per connection. The pool size should equal
+ * the maximum number of concurrent sessions, as each session worker occupies a thread until the
+ * session ends.
+ */
+class thread_pool {
+public:
+    /**
+     * @brief create new object
+     * @param size the number of threads in the pool
+     */
+    explicit thread_pool(std::size_t size) {
+        threads_.reserve(size);
+        for (std::size_t i = 0; i < size; i++) {
+            threads_.emplace_back([this]{ process(); });
+        }
+    }
+
+    /**
+     * @brief destruct the object, finishing queued tasks and joining the threads
+     */
+    ~thread_pool() {
+        {
+            std::unique_lock<std::mutex> lock(mtx_);
+            stop_ = true;
+        }
+        cond_.notify_all();
+        for (auto&& e : threads_) {
+            e.join();
+        }
+    }
+
+    thread_pool(thread_pool const&) = delete;
+    thread_pool(thread_pool&&) = delete;
+    thread_pool& operator = (thread_pool const&) = delete;
+    thread_pool& operator = (thread_pool&&) = delete;
+
+    /**
+     * @brief post a task for execution on one of the pooled threads
+     * @param task the task to execute
+     */
+    void post(std::function<void()> task) {
+        {
+            std::unique_lock<std::mutex> lock(mtx_);
+            tasks_.emplace_back(std::move(task));
+        }
+        cond_.notify_one();
+    }
+
+private:
+    std::vector<std::thread> threads_{};
+    std::deque<std::function<void()>> tasks_{};
+    std::mutex mtx_{};
+    std::condition_variable cond_{};
+    bool stop_{};
+
+    void process() {
+        while (true) {
+            std::function<void()> task{};
+            {
+                std::unique_lock<std::mutex> lock(mtx_);
+                cond_.wait(lock, [this]{ return stop_ || !tasks_.empty(); });
+                if (tasks_.empty()) {  // here stop_ is true
+                    break;
+                }
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            }
+            task();
+        }
+    }
+};
+
+}  // tateyama::endpoint::common
@@ -15,11 +15,11 @@
  */
 #pragma once
 
-#include <future>
+#include <atomic>
 #include <thread>
 #include <memory>
 #include <functional>
-#include <map>
+#include <optional>
 #include <utility>
 #include <vector>
 #include <mutex>
@@ -34,6 +34,8 @@
 #include <tateyama/session/variable_set.h>
 #include <tateyama/api/server/session_store.h>
 
+#include <google/protobuf/arena.h>
+
 #include <tateyama/proto/endpoint/request.pb.h>
 #include <tateyama/proto/endpoint/response.pb.h>
 #include <tateyama/proto/core/request.pb.h>
@@ -43,6 +45,7 @@
 #include "request.h"
 #include "response.h"
 #include "session_info_impl.h"
+#include "thread_pool.h"
 
 namespace tateyama::endpoint::common {
 
@@ -97,6 +100,7 @@ public:
     worker_common(const configuration& config, std::size_t session_id, std::string_view conn_info)
         : connection_type_(config.con_),
           session_id_(session_id),
+          session_id_str_(std::to_string(session_id)),
           session_info_(session_id_, connection_label(config.con_), conn_info),
           session_(config.session_),
           session_variable_set_(variable_declarations()),
@@ -121,14 +125,47 @@ public:
     worker_common& operator = (worker_common const&) = delete;
     worker_common& operator = (worker_common&&) = delete;
 
-    void invoke(std::function<void(void)> func) {
-        task_ = std::packaged_task<void()>(std::move(func));
-        future_ = task_.get_future();
-        thread_ = std::thread(std::move(task_));
+    /**
+     * @brief run the given function as the worker body
+     * @param func the worker body
+     * @param pool the thread pool to run the worker on, or nullptr to spawn a dedicated thread
+     */
+    void invoke(std::function<void(void)> func, thread_pool* pool = nullptr) {
+        finished_.store(false, std::memory_order_relaxed);
+        // a plain atomic flag is enough to observe completion - no shared state allocation as
+        // with packaged_task/future; exceptions are swallowed here as the future used to do,
+        // and the flag is set on every exit path so the worker is always reaped
+        auto body = [this, func = std::move(func)]() {
+            struct completion_guard {
+                explicit completion_guard(std::atomic_bool& finished) : finished_(finished) {
+                }
+                ~completion_guard() {
+                    finished_.store(true, std::memory_order_release);
+                }
+                completion_guard(completion_guard const&) = delete;
+                completion_guard(completion_guard&&) = delete;
+                completion_guard& operator = (completion_guard const&) = delete;
+                completion_guard& operator = (completion_guard&&) = delete;
+
+                std::atomic_bool& finished_;
+            } guard{finished_};
+            try {
+                func();
+            } catch (std::exception const& ex) {
+                LOG_LP(ERROR) << "exception escaped from a session worker: " << ex.what();
+            } catch (...) {
+                LOG_LP(ERROR) << "unknown exception escaped from a session worker";
+            }
+        };
+        if (pool) {
+            pool->post(std::move(body));
+        } else {
+            thread_ = std::thread(std::move(body));
+        }
     }
 
     [[nodiscard]] bool is_terminated() const {
-        return future_.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        return finished_.load(std::memory_order_acquire);
     }
 
     [[nodiscard]] bool is_quiet() {
@@ -159,6 +196,7 @@ public:
 protected:
     const connection_type connection_type_; // NOLINT
     const std::size_t session_id_;          // NOLINT
+    const std::string session_id_str_;      // NOLINT  formatted once, logged many times
     session_info_impl session_info_;        // NOLINT
 
     // for ipc endpoint only
@@ -166,9 +204,8 @@ protected:
     // for stream endpoint only
     std::size_t max_result_sets_{};         // NOLINT
 
-    // for future
-    std::packaged_task<void()> task_;       // NOLINT
-    std::future<void> future_;              // NOLINT
+    // worker body completion flag, set by the thread running the body
+    std::atomic_bool finished_{};           // NOLINT
     std::thread thread_{};                  // NOLINT
 
     // for session management
@@ -187,21 +224,23 @@ protected:
             return false;
         }
         auto data = req->payload();
-        tateyama::proto::endpoint::request::Request rq{};
-        if(! rq.ParseFromArray(data.data(), static_cast<int>(data.size()))) {
+        // arena allocation pools the child message allocations of the parse
+        google::protobuf::Arena arena{};
+        auto* rq = google::protobuf::Arena::CreateMessage<tateyama::proto::endpoint::request::Request>(&arena);
+        if(! rq->ParseFromArray(data.data(), static_cast<int>(data.size()))) {
             std::string error_message{"request parse error"};
             LOG_LP(INFO) << error_message;
             notify_client(res, tateyama::proto::diagnostics::Code::INVALID_REQUEST, error_message);
             return false;
         }
-        if(rq.command_case() != tateyama::proto::endpoint::request::Request::kHandshake) {
+        if(rq->command_case() != tateyama::proto::endpoint::request::Request::kHandshake) {
             std::stringstream ss;
-            ss << "bad request (handshake in endpoint): " << rq.command_case();
+            ss << "bad request (handshake in endpoint): " << rq->command_case();
             LOG_LP(INFO) << ss.str();
             notify_client(res, tateyama::proto::diagnostics::Code::INVALID_REQUEST, ss.str());
             return false;
         }
-        auto ci = rq.handshake().client_information();
+        const auto& ci = rq->handshake().client_information();
         std::string connection_label = ci.connection_label();
         if (!connection_label.empty()) {
             if (connection_label.at(0) == ':') {
@@ -213,7 +252,7 @@ protected:
         session_info_.application_name(ci.application_name());
         // FIXME handle userName when a credential specification is fixed.
 
-        auto wi = rq.handshake().wire_information();
+        const auto& wi = rq->handshake().wire_information();
         switch (connection_type_) {
         case connection_type::ipc:
             if(wi.wire_information_case() != tateyama::proto::endpoint::request::WireInformation::kIpcInformation) {
@@ -253,7 +292,9 @@ protected:
         return true;
     }
 
-    static void notify_client(tateyama::api::server::response* res,
+    // cold lets the compiler treat every branch leading here as unlikely and move the
+    // diagnostics code out of the hot dispatch path
+    __attribute__((cold)) static void notify_client(tateyama::api::server::response* res,
                        tateyama::proto::diagnostics::Code code,
                        const std::string& message) {
         tateyama::proto::diagnostics::Record record{};
@@ -266,15 +307,16 @@ protected:
                           const std::shared_ptr<tateyama::endpoint::common::response>& res,
                           std::size_t slot) {
         auto data = req->payload();
-        tateyama::proto::endpoint::request::Request rq{};
-        if(! rq.ParseFromArray(data.data(), static_cast<int>(data.size()))) {
+        google::protobuf::Arena arena{};
+        auto* rq = google::protobuf::Arena::CreateMessage<tateyama::proto::endpoint::request::Request>(&arena);
+        if(! rq->ParseFromArray(data.data(), static_cast<int>(data.size()))) {
             std::string error_message{"request parse error"};
             LOG_LP(INFO) << error_message;
             notify_client(res.get(), tateyama::proto::diagnostics::Code::INVALID_REQUEST, error_message);
             return false;
         }
 
-        switch (rq.command_case()) {
+        switch (rq->command_case()) {
 
         case tateyama::proto::endpoint::request::Request::kCancel:
         {
@@ -282,8 +324,8 @@ protected:
             res->set_completed();
             {
                 std::lock_guard<std::mutex> lock(mtx_reqreses_);
-                if (auto itr = reqreses_.find(slot); itr != reqreses_.end()) {
-                    itr->second.second->cancel();
+                if (slot < reqreses_.size() && reqreses_.at(slot)) {
+                    reqreses_.at(slot)->second->cancel();
                 }
             }
             return true;
@@ -292,7 +334,7 @@ protected:
         default: // error
         {
             std::stringstream ss;
-            ss << "bad request for endpoint: " << rq.command_case();
+            ss << "bad request for endpoint: " << rq->command_case();
             LOG_LP(INFO) << ss.str();
             notify_client(res.get(), tateyama::proto::diagnostics::Code::INVALID_REQUEST, ss.str());
         }
@@ -304,22 +346,23 @@ protected:
                                const std::shared_ptr<tateyama::api::server::response>& res,
                                std::size_t index) {
         auto data = req->payload();
-        tateyama::proto::core::request::Request rq{};
-        if(! rq.ParseFromArray(data.data(), static_cast<int>(data.size()))) {
+        google::protobuf::Arena arena{};
+        auto* rq = google::protobuf::Arena::CreateMessage<tateyama::proto::core::request::Request>(&arena);
+        if(! rq->ParseFromArray(data.data(), static_cast<int>(data.size()))) {
             std::string error_message{"request parse error"};
             LOG_LP(INFO) << error_message;
             notify_client(res.get(), tateyama::proto::diagnostics::Code::INVALID_REQUEST, error_message);
             return false;
         }
 
-        switch (rq.command_case()) {
+        switch (rq->command_case()) {
 
         case tateyama::proto::core::request::Request::kShutdown:
         {
             VLOG_LP(log_trace) << "received shutdown request";  //NOLINT
 
             tateyama::session::shutdown_request_type shutdown_type{};
-            switch (rq.shutdown().type()) {
+            switch (rq->shutdown().type()) {
             case tateyama::proto::core::request::ShutdownType::SHUTDOWN_TYPE_NOT_SET:
                 shutdown_type = tateyama::session::shutdown_request_type::forceful;
                 break;
@@ -340,7 +383,7 @@ protected:
 
         case tateyama::proto::core::request::Request::kUpdateExpirationTime:
         {
-            const auto& command = rq.update_expiration_time();
+            const auto& command = rq->update_expiration_time();
             if (command.expiration_time_opt_case() == tateyama::proto::core::request::UpdateExpirationTime::ExpirationTimeOptCase::kExpirationTime) {
                 auto et = std::chrono::milliseconds{command.expiration_time()};
                 if (refresh_timeout_ > et) {
@@ -391,16 +434,21 @@ protected:
 
     void register_reqres(std::size_t slot, const std::shared_ptr<tateyama::api::server::request>& request, const std::shared_ptr<tateyama::endpoint::common::response>& response) noexcept {
         std::lock_guard<std::mutex> lock(mtx_reqreses_);
-        if (auto itr = reqreses_.find(slot); itr != reqreses_.end()) {
-            reqreses_.erase(itr);
+        if (slot >= reqreses_.size()) {
+            reqreses_.resize(slot + 1);
         }
-        reqreses_.emplace(slot, std::pair<std::shared_ptr<tateyama::api::server::request>, std::shared_ptr<tateyama::endpoint::common::response>>(request, response));
+        auto& entry = reqreses_.at(slot);
+        if (!entry) {
+            reqres_count_++;
+        }
+        entry.emplace(request, response);
     }
 
     void remove_reqres(std::size_t slot) noexcept {
         std::lock_guard<std::mutex> lock(mtx_reqreses_);
-        if (auto&& itr = reqreses_.find(slot); itr != reqreses_.end()) {
-            reqreses_.erase(itr);
+        if (slot < reqreses_.size() && reqreses_.at(slot)) {
+            reqreses_.at(slot).reset();
+            reqres_count_--;
         }
     }
 
@@ -415,19 +463,32 @@ protected:
     }
 
     void care_reqreses() {
+        if (reqres_count_.load(std::memory_order_acquire) == 0) {
+            return;  // nothing outstanding, skip the lock on this tick
+        }
+        // completed responses remove themselves from the table, so what remains for this
+        // sweep is dissipation - entries dropped by the service without completing - which
+        // only a use_count scan can detect; rate limit it so that busy iterations do not
+        // rescan entries that had no time to change
+        auto now = std::chrono::steady_clock::now();
+        if (now - last_care_ < care_interval) {
+            return;
+        }
+        last_care_ = now;
         std::vector<std::shared_ptr<tateyama::endpoint::common::response>> targets{};
         {
             std::lock_guard<std::mutex> lock(mtx_reqreses_);
-            for (auto itr{reqreses_.begin()}, end{reqreses_.end()}; itr != end; ) {
-                auto&& pair = itr->second;
-                auto && res = itr->second.second;
-                if ((pair.first.use_count() == 1) && (res.use_count() == 1)) {
+            for (auto&& entry : reqreses_) {
+                if (!entry) {
+                    continue;
+                }
+                auto&& res = entry->second;
+                if ((entry->first.use_count() == 1) && (res.use_count() == 1)) {
                     if (!res->is_completed()) {
                         targets.emplace_back(res);
                     }
-                    itr = reqreses_.erase(itr);
-                } else {
-                    ++itr;
+                    entry.reset();
+                    reqres_count_--;
                 }
             }
         }
@@ -437,25 +498,23 @@ protected:
     }
 
     bool is_completed() {
-        std::lock_guard<std::mutex> lock(mtx_reqreses_);
-        return reqreses_.empty();
+        return reqres_count_.load(std::memory_order_acquire) == 0;
     }
 
     void foreach_reqreses(const std::function<void(tateyama::endpoint::common::response&)>& func) {
         std::vector<std::shared_ptr<tateyama::endpoint::common::response>> targets{};
         {
             std::lock_guard<std::mutex> lock(mtx_reqreses_);
-            for (auto itr{reqreses_.begin()}, end{reqreses_.end()}; itr != end; ) {
-                auto& ptr = itr->second.second;
+            for (auto&& entry : reqreses_) {
+                if (!entry) {
+                    continue;
+                }
+                auto& ptr = entry->second;
                 if (ptr.use_count() > 1) {
                     targets.emplace_back(ptr);
-                    ++itr;
-                } else {
-                    if (itr->second.first.use_count() == 1) {
-                        itr = reqreses_.erase(itr);
-                    } else {
-                        ++itr;
-                    }
+                } else if (entry->first.use_count() == 1) {
+                    entry.reset();
+                    reqres_count_--;
                 }
             }
         }
@@ -507,8 +566,22 @@ private:
     bool enable_timeout_;
     std::chrono::seconds refresh_timeout_;
     std::chrono::seconds max_refresh_timeout_;
-    std::map<std::size_t, std::pair<std::shared_ptr<tateyama::api::server::request>, std::shared_ptr<tateyama::endpoint::common::response>>> reqreses_{};
+    /*
+     * @brief outstanding request/response pairs indexed by slot
+     * @details slots are small dense integers handed out by the endpoints, so a flat vector
+     * indexed by slot replaces the former std::map: insert and removal become O(1) element
+     * writes without the node allocation per request, and sweeps walk contiguous memory.
+     * Entries are disengaged in place, so the number of live entries is tracked separately.
+     * @attention use mtx_reqreses_ to be thread-safe
+     */
+    std::vector<std::optional<std::pair<std::shared_ptr<tateyama::api::server::request>, std::shared_ptr<tateyama::endpoint::common::response>>>> reqreses_{};
+    // maintained under mtx_reqreses_, but atomic so that the per-tick emptiness checks of
+    // the worker loop read it without taking the lock
+    std::atomic<std::size_t> reqres_count_{};
     std::mutex mtx_reqreses_{};
+    // the dissipation sweep runs at most once per interval; touched by the worker thread only
+    static constexpr std::chrono::seconds care_interval{1};
+    std::chrono::steady_clock::time_point last_care_{};
     std::vector<std::shared_ptr<tateyama::api::server::response>> shutdown_response_{};
     bool cancel_requested_to_all_responses_{};
     bool dispose_done_{};
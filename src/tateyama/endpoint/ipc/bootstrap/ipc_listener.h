@@ -15,6 +15,9 @@
  */
 #pragma once
 
+#include <array>
+#include <charconv>
+#include <limits>
 #include <memory>
 #include <vector>
 #include <set>
@@ -23,6 +26,7 @@
 #include <thread>
 #include <chrono>
 #include <mutex>
+#include <atomic>
 #include <csignal>
 
 #include <boost/thread/barrier.hpp>
@@ -68,6 +72,7 @@ public:
         if (database_name_.empty()) {
             throw std::runtime_error("database_name in ipc_endpoint section should not be empty");
         }
+        session_name_prefix_ = database_name_ + "-";
 
         auto threads_opt = endpoint_config->get<std::size_t>("threads");
         if (!threads_opt) {
@@ -105,6 +110,10 @@ public:
         // worker objects
         workers_.resize(threads + admin_sessions);
 
+        // worker threads - one per possible concurrent session, spawned once so that session
+        // establishment pays a queue push instead of a thread creation
+        thread_pool_ = std::make_unique<tateyama::endpoint::common::thread_pool>(threads + admin_sessions);
+
         // set maximum thread size to status objects
         status_->set_maximum_sessions(threads + admin_sessions);
 
@@ -197,9 +206,14 @@ public:
                 auto slot_id = connection_queue.slot();
                 auto slot_index = tateyama::common::wire::connection_queue::reset_admin(slot_id);
                 try {
-                    std::string session_name = database_name_;
-                    session_name += "-";
-                    session_name += std::to_string(session_id);
+                    // format "<database_name>-<session_id>" with a single allocation: the prefix
+                    // is preformatted at setup and the id goes through to_chars, not snprintf
+                    std::array<char, std::numeric_limits<std::size_t>::digits10 + 1> digits{};
+                    auto* digits_end = std::to_chars(digits.data(), digits.data() + digits.size(), session_id).ptr;
+                    std::string session_name{};
+                    session_name.reserve(session_name_prefix_.size() + static_cast<std::size_t>(digits_end - digits.data()));
+                    session_name.append(session_name_prefix_);
+                    session_name.append(digits.data(), digits_end);
                     auto wire = std::make_shared<server_wire_container_impl>(session_name, proc_mutex_file_, datachannel_buffer_size_, max_datachannel_buffers_, [this, session_id, slot_index](){status_->remove_shm_entry(session_id, slot_index);});
                     VLOG_LP(log_trace) << "create session wire: " << session_name << " at index " << slot_index;
                     status_->add_shm_entry(session_id, slot_index);
@@ -223,11 +237,12 @@ public:
                             std::unique_lock<std::mutex> lock_w(mtx_workers_);
                             std::unique_lock<std::mutex> lock_u(mtx_undertakers_);
                             undertakers_.emplace(std::move(worker));
+                            undertaker_count_.fetch_add(1, std::memory_order_release);
                         }
                         connection_queue.disconnect(slot_id);
                         wp->delete_hook();
                         ipc_metrics_.decrease();
-                    });
+                    }, thread_pool_.get());
                 } catch (std::exception& ex) {
                     LOG_LP(ERROR) << ex.what();
                     connection_queue.reject(slot_id);
@@ -274,23 +289,32 @@ private:
     tateyama::endpoint::ipc::metrics::ipc_metrics ipc_metrics_;
 
     std::unique_ptr<connection_container> container_{};
+    std::unique_ptr<tateyama::endpoint::common::thread_pool> thread_pool_{};
     std::vector<std::shared_ptr<ipc_worker>> workers_{};
     std::set<std::shared_ptr<ipc_worker>, tateyama::endpoint::common::pointer_comp<ipc_worker>> undertakers_{};
     std::string database_name_;
+    std::string session_name_prefix_;
     std::string proc_mutex_file_;
     std::size_t datachannel_buffer_size_{};
     std::size_t max_datachannel_buffers_{};
     std::size_t writer_count_{ipc_response::default_writer_count};
     std::mutex mtx_workers_{};
     std::mutex mtx_undertakers_{};
+    std::atomic_size_t undertaker_count_{};
 
     boost::barrier sync{2};
 
     bool care_undertakers() {
+        // checked on every accept loop iteration - skip the mutex and the per-worker future
+        // polling in is_quiet() while no worker is awaiting disposal, which is the common case
+        if (undertaker_count_.load(std::memory_order_acquire) == 0) {
+            return true;
+        }
         std::unique_lock<std::mutex> lock(mtx_undertakers_);
         for (auto it{undertakers_.begin()}, end{undertakers_.end()}; it != end; ) {
             if ((*it)->is_quiet()) {
                 it = undertakers_.erase(it);
+                undertaker_count_.fetch_sub(1, std::memory_order_release);
             } else {
                 ++it;
             }
@@ -33,7 +33,7 @@ void ipc_worker::run() {  // NOLINT(readability-function-cognitive-complexity)
             continue;
         }
         if (hdr.get_length() == 0 && hdr.get_idx() == tateyama::common::wire::message_header::terminate_request) {
-            VLOG_LP(log_trace) << "received shutdown request: session_id = " << std::to_string(session_id_);
+            VLOG_LP(log_trace) << "received shutdown request: session_id = " << session_id_str_;
             return;
         }
 
@@ -51,6 +51,8 @@ void ipc_worker::run() {  // NOLINT(readability-function-cognitive-complexity)
     tateyama::endpoint::altimeter::session_start(database_info_, session_info_);
 #endif
     bool notiry_expiration_time_over{};
+    // loop invariants hoisted out of the per-message path
+    auto* garbage_collector = wire_->get_garbage_collector();
     while(true) {
         try {
             hdr = request_wire_container_->peep();
@@ -87,9 +89,7 @@ void ipc_worker::run() {  // NOLINT(readability-function-cognitive-complexity)
             {
                 auto response = std::make_shared<ipc_response>(wire_, hdr.get_idx(), writer_count_, [](){});
                 // currently cancel request only
-                if (!endpoint_service(std::dynamic_pointer_cast<tateyama::api::server::request>(request),
-                                      std::dynamic_pointer_cast<tateyama::endpoint::common::response>(response),
-                                      index)) {
+                if (!endpoint_service(request, response, index)) {
                     VLOG_LP(log_info) << "terminate worker because endpoint service returns an error";
                     exit_frag = true;
                 }
@@ -98,21 +98,16 @@ void ipc_worker::run() {  // NOLINT(readability-function-cognitive-complexity)
             case tateyama::framework::service_id_routing:
             {
                 auto response = std::make_shared<ipc_response>(wire_, hdr.get_idx(), writer_count_, [this, index](){remove_reqres(index);});
-                register_reqres(index,
-                                std::dynamic_pointer_cast<tateyama::api::server::request>(request),
-                                std::dynamic_pointer_cast<tateyama::endpoint::common::response>(response));
-                if (routing_service_chain(std::dynamic_pointer_cast<tateyama::api::server::request>(request),
-                                          std::dynamic_pointer_cast<tateyama::api::server::response>(response),
-                                          index)) {
+                register_reqres(index, request, response);
+                if (routing_service_chain(request, response, index)) {
                     care_reqreses();
                     if (check_shutdown_request() && is_completed()) {
-                        VLOG_LP(log_trace) << "received and completed shutdown request: session_id = " << std::to_string(session_id_);
+                        VLOG_LP(log_trace) << "received and completed shutdown request: session_id = " << session_id_str_;
                         exit_frag = true;
                     }
                     break;  // break the switch, and set exit_flag true to break the while loop
                 }
-                if (!service_(std::dynamic_pointer_cast<tateyama::api::server::request>(request),
-                              std::dynamic_pointer_cast<tateyama::api::server::response>(response))) {
+                if (!service_(request, response)) {
                     VLOG_LP(log_info) << "terminate worker because service returns an error";
                     exit_frag = true;
                 }
@@ -120,18 +115,17 @@ void ipc_worker::run() {  // NOLINT(readability-function-cognitive-complexity)
             }
             default:
             {
-                auto response = std::make_shared<ipc_response>(wire_, hdr.get_idx(), writer_count_, [this, index](){remove_reqres(index);});
                 if (!check_shutdown_request()) {
-                    register_reqres(index,
-                                    std::dynamic_pointer_cast<tateyama::api::server::request>(request),
-                                    std::dynamic_pointer_cast<tateyama::endpoint::common::response>(response));
-                    if (!service_(std::dynamic_pointer_cast<tateyama::api::server::request>(request),
-                                  std::dynamic_pointer_cast<tateyama::api::server::response>(response))) {
+                    auto response = std::make_shared<ipc_response>(wire_, hdr.get_idx(), writer_count_, [this, index](){remove_reqres(index);});
+                    register_reqres(index, request, response);
+                    if (!service_(request, response)) {
                         VLOG_LP(log_info) << "terminate worker because service returns an error";
                         exit_frag = true;
                     }
                 } else {
-                    notify_client(response.get(), tateyama::proto::diagnostics::SESSION_CLOSED, "this session is already shutdown");
+                    // shutting down - the response is used once on this thread, so no shared ownership needed
+                    ipc_response response_obj{wire_, hdr.get_idx(), writer_count_, [](){}};
+                    notify_client(&response_obj, tateyama::proto::diagnostics::SESSION_CLOSED, "this session is already shutdown");
                 }
                 break;  // break the switch, and set exit_flag true to break the while loop
             }
@@ -141,13 +135,13 @@ void ipc_worker::run() {  // NOLINT(readability-function-cognitive-complexity)
             }
             request->dispose();
             request = nullptr;
-            wire_->get_garbage_collector()->dump();
+            garbage_collector->dump();
         } catch (std::runtime_error &e) {
             LOG_LP(ERROR) << e.what();
             break;  // break the while loop
         }
     }
-    VLOG_LP(log_trace) << "destroy session wire: session_id = " << std::to_string(session_id_);
+    VLOG_LP(log_trace) << "destroy session wire: session_id = " << session_id_str_;
 #ifdef ENABLE_ALTIMETER
     tateyama::endpoint::altimeter::session_end(database_info_, session_info_, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - session_start_time).count());
 #endif
@@ -156,7 +150,7 @@ void ipc_worker::run() {  // NOLINT(readability-function-cognitive-complexity)
 
 // Processes shutdown requests from outside the communication partner.
 bool ipc_worker::terminate(tateyama::session::shutdown_request_type type) {
-    VLOG_LP(log_trace) << "send terminate request: session_id = " << std::to_string(session_id_);
+    VLOG_LP(log_trace) << "send terminate request: session_id = " << session_id_str_;
 
     auto rv = request_shutdown(type);
     wire_->get_request_wire()->notify();
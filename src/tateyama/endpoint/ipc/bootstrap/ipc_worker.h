@@ -34,11 +34,11 @@ public:
                const tateyama::api::server::database_info& database_info,
                std::size_t writer_count) :
         worker_common(conf, session_id, ""),
+            request_wire_container_(dynamic_cast<server_wire_container_impl::wire_container_impl*>(wire->get_request_wire())),
             service_(service),
+            writer_count_(writer_count),
             wire_(std::move(wire)),
-            request_wire_container_(dynamic_cast<server_wire_container_impl::wire_container_impl*>(wire_->get_request_wire())),
-            database_info_(database_info),
-            writer_count_(writer_count) {
+            database_info_(database_info) {
     }
     void delete_hook() {
         shutdown_complete();
@@ -49,11 +49,15 @@ public:
     [[nodiscard]] std::size_t session_id() const noexcept { return session_id_; }
 
 private:
+    // fields touched on every iteration of the run() loop, grouped so that the per-message
+    // path reads a single cache line of this object until the request is dispatched
+    server_wire_container_impl::wire_container_impl* request_wire_container_;
     tateyama::framework::routing_service& service_;
+    std::size_t writer_count_;
+
+    // fields touched only at session setup and teardown
     std::shared_ptr<server_wire_container_impl> wire_;
-    server_wire_container_impl::wire_container_impl* request_wire_container_;
     const tateyama::api::server::database_info& database_info_;
-    std::size_t writer_count_;
 
     bool has_incomplete_resultset() override {
         auto* gc = wire_->get_garbage_collector();
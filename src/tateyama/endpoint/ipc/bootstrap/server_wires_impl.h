@@ -25,6 +25,8 @@
 #include <string_view>
 #include <functional>
 
+#include <sys/mman.h>
+
 #include <glog/logging.h>
 #include <tateyama/logging.h>
 
@@ -33,6 +35,15 @@
 
 namespace tateyama::endpoint::ipc::bootstrap {
 
+/**
+ * @brief advise the kernel to back the shared memory segment with huge pages
+ * @details purely advisory: it takes effect only when transparent huge pages are enabled for
+ * shared memory on the system, cutting dTLB misses on wire accesses, and is a no-op otherwise
+ */
+static inline void advise_huge_pages(boost::interprocess::managed_shared_memory& managed_shared_memory) {
+    madvise(managed_shared_memory.get_address(), managed_shared_memory.get_size(), MADV_HUGEPAGE);
+}
+
 class server_wire_container_impl : public server_wire_container
 {
     static constexpr std::size_t request_buffer_size = (1<<12);   //  4K bytes NOLINT
@@ -519,6 +530,7 @@ public:
 
             managed_shared_memory_ =
                 std::make_unique<boost::interprocess::managed_shared_memory>(boost::interprocess::create_only, name_.c_str(), proportional_memory_size(datachannel_buffer_size_, max_datachannel_buffers), nullptr, unrestricted_permissions);
+            advise_huge_pages(*managed_shared_memory_);
             auto req_wire = managed_shared_memory_->construct<tateyama::common::wire::unidirectional_message_wire>(tateyama::common::wire::request_wire_name)(managed_shared_memory_.get(), request_buffer_size);
             auto res_wire = managed_shared_memory_->construct<tateyama::common::wire::unidirectional_response_wire>(tateyama::common::wire::response_wire_name)(managed_shared_memory_.get(), response_buffer_size);
             status_provider_ = managed_shared_memory_->construct<tateyama::common::wire::status_provider>(tateyama::common::wire::status_provider_name)(managed_shared_memory_.get(), mutex_file);
@@ -617,6 +629,7 @@ public:
 
             managed_shared_memory_ =
                 std::make_unique<boost::interprocess::managed_shared_memory>(boost::interprocess::create_only, name_.c_str(), fixed_memory_size(threads + admin_sessions), nullptr, unrestricted_permissions);
+            advise_huge_pages(*managed_shared_memory_);
             managed_shared_memory_->destroy<tateyama::common::wire::connection_queue>(tateyama::common::wire::connection_queue::name);
             connection_queue_ = managed_shared_memory_->construct<tateyama::common::wire::connection_queue>(tateyama::common::wire::connection_queue::name)(threads, managed_shared_memory_->get_segment_manager(), static_cast<std::uint8_t>(admin_sessions));
         }
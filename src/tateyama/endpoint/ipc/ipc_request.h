@@ -19,6 +19,9 @@
 #include <array>
 #include <exception>
 
+#include <glog/logging.h>
+
+#include <tateyama/logging.h>
 #include <tateyama/endpoint/common/request.h>
 
 #include "server_wires.h"
@@ -60,10 +63,23 @@ public:
 
     ipc_request() = delete;
 
-    [[nodiscard]] std::string_view payload() const override;
-    void dispose();
-    [[nodiscard]] std::size_t session_id() const override;
-    [[nodiscard]] std::size_t service_id() const override;
+    // accessors are defined inline so the hot dispatch path does not cross a translation unit boundary
+    [[nodiscard]] std::string_view payload() const override {
+        VLOG_LP(log_trace) << static_cast<const void*>(&server_wire_) << " length = " << payload_.length() << " slot = " << index_;  //NOLINT
+        return payload_;
+    }
+
+    void dispose() {
+        VLOG_LP(log_trace) << static_cast<const void*>(&server_wire_) << " slot = " << index_;  //NOLINT
+    }
+
+    [[nodiscard]] std::size_t session_id() const override {
+        return session_id_;
+    }
+
+    [[nodiscard]] std::size_t service_id() const override {
+        return service_id_;
+    }
 
 private:
     server_wire_container& server_wire_;
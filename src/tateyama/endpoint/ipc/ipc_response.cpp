@@ -33,14 +33,13 @@ tateyama::status ipc_response::body(std::string_view body) {
         VLOG_LP(log_trace) << static_cast<const void*>(server_wire_.get()) << " length = " << body.length() << " slot = " << index_;  //NOLINT
         clean_up_();
 
-        std::stringstream ss{};
+        std::string s{};
         endpoint::common::header_content arg{};
         arg.session_id_ = session_id_;
-        if(auto res = endpoint::common::append_response_header(ss, body, arg, ::tateyama::proto::framework::response::Header::SERVICE_RESULT); ! res) {
+        if(auto res = endpoint::common::append_response_header(s, body, arg, ::tateyama::proto::framework::response::Header::SERVICE_RESULT); ! res) {
             LOG_LP(ERROR) << "error formatting response message";
             return status::unknown;
         }
-        auto s = ss.str();
         server_wire_->get_response_wire().write(s.data(), tateyama::common::wire::response_header(index_, s.length(), RESPONSE_BODY));
         return tateyama::status::ok;
     }
@@ -55,14 +54,13 @@ tateyama::status ipc_response::body_head(std::string_view body_head) {
     }
     VLOG_LP(log_trace) << static_cast<const void*>(server_wire_.get()) << " slot = " << index_;  //NOLINT
 
-    std::stringstream ss{};
+    std::string s{};
     endpoint::common::header_content arg{};
     arg.session_id_ = session_id_;
-    if(auto res = endpoint::common::append_response_header(ss, body_head, arg, ::tateyama::proto::framework::response::Header::SERVICE_RESULT); ! res) {
+    if(auto res = endpoint::common::append_response_header(s, body_head, arg, ::tateyama::proto::framework::response::Header::SERVICE_RESULT); ! res) {
         LOG_LP(ERROR) << "error formatting response message";
         return status::unknown;
     }
-    auto s = ss.str();
     server_wire_->get_response_wire().write(s.data(), tateyama::common::wire::response_header(index_, s.length(), RESPONSE_BODYHEAD));
     return tateyama::status::ok;
 }
@@ -86,14 +84,13 @@ void ipc_response::error(proto::diagnostics::Record const& record) {
 }
 
 void ipc_response::server_diagnostics(std::string_view diagnostic_record) {
-    std::stringstream ss{};
+    std::string s{};
     endpoint::common::header_content arg{};
     arg.session_id_ = session_id_;
-    if(! endpoint::common::append_response_header(ss, diagnostic_record, arg, tateyama::proto::framework::response::Header::SERVER_DIAGNOSTICS)) {
+    if(! endpoint::common::append_response_header(s, diagnostic_record, arg, tateyama::proto::framework::response::Header::SERVER_DIAGNOSTICS)) {
         LOG_LP(ERROR) << "error formatting response message";
         return;
     }
-    auto s = ss.str();
     server_wire_->get_response_wire().write(s.data(), tateyama::common::wire::response_header(index_, s.length(), RESPONSE_BODY));
 }
 
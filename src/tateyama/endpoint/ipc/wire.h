@@ -338,13 +338,16 @@ protected:
     boost::interprocess::managed_shared_memory::handle_t buffer_handle_{};  //NOLINT
     std::size_t capacity_;  //NOLINT
 
-    std::atomic_ulong pushed_{0};  //NOLINT
-    std::atomic_ulong poped_{0};  //NOLINT
-
+    // writer-side and reader-side fields are kept on separate cache lines, as the wire is
+    // accessed from both ends of the connection and false sharing would bounce the line
+    // between the processes on every message
+    alignas(Alignment) std::atomic_ulong pushed_{0};  //NOLINT
     std::atomic_bool wait_for_write_{};  //NOLINT
+
+    alignas(Alignment) std::atomic_ulong poped_{0};  //NOLINT
     std::atomic_bool wait_for_read_{};  //NOLINT
 
-    boost::interprocess::interprocess_mutex m_mutex_{};  //NOLINT
+    alignas(Alignment) boost::interprocess::interprocess_mutex m_mutex_{};  //NOLINT
     boost::interprocess::interprocess_condition c_empty_{};  //NOLINT
     boost::interprocess::interprocess_condition c_full_{};  //NOLINT
     T header_received_{};  // NOLINT
@@ -383,6 +386,12 @@ public:
      */
     message_header peep(const char* base) {
         while (true) {
+            // fast path for a loaded session: a message is already stored, so return it without
+            // reading the termination/notification flags (shared with other threads) or the fence
+            if(stored() >= message_header::size) {
+                copy_header(base);
+                return header_received_;
+            }
             bool termination_requested = termination_requested_.load();
             bool onetime_notification = onetime_notification_.load();
             std::atomic_thread_fence(std::memory_order_acq_rel);
@@ -1055,6 +1064,12 @@ public:
             }
         }
         [[nodiscard]] bool wait(std::atomic_bool& terminate) {
+            // fast path for a connection storm: a request is already queued (or termination
+            // has been requested), so the answer is known without the mutex and the
+            // condition wait, which are only needed to sleep on an empty queue
+            if ((pushed_.load(std::memory_order_acquire) > poped_.load()) || terminate.load()) {
+                return true;
+            }
             boost::interprocess::scoped_lock lock(mutex_);
             std::atomic_thread_fence(std::memory_order_acq_rel);
             return condition_.timed_wait(lock,
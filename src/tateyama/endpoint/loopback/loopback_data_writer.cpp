@@ -21,22 +21,38 @@ namespace tateyama::endpoint::loopback {
 tateyama::status loopback_data_writer::write(const char *data, std::size_t length) {
     if (length > 0) {
         // NOTE: data is binary data. It maybe data="\0\1\2\3", length=4 etc.
-        current_data_.append(data, length);
+        if (data_.capacity() < initial_data_capacity) {
+            data_.reserve(initial_data_capacity);
+        }
+        data_.append(data, length);
     }
     return tateyama::status::ok;
 }
 
 tateyama::status loopback_data_writer::commit() {
-    if (current_data_.length() > 0) {
-        committed_data_list_.emplace_back(std::move(current_data_));
-        current_data_ = { };
+    const std::size_t committed = record_ends_.empty() ? 0 : record_ends_.back();
+    if (data_.length() > committed) {
+        if (record_ends_.capacity() == 0) {
+            record_ends_.reserve(initial_commit_capacity);
+        }
+        record_ends_.emplace_back(data_.length());
     }
     return tateyama::status::ok;
 }
 
-std::vector<std::string> loopback_data_writer::release_committed_data() noexcept {
+std::vector<std::string> loopback_data_writer::committed_data() const {
     std::vector<std::string> result { };
-    committed_data_list_.swap(result);
+    result.reserve(record_ends_.size());
+    for (std::size_t i = 0; i < record_ends_.size(); i++) {
+        result.emplace_back(record(i));
+    }
+    return result;
+}
+
+std::vector<std::string> loopback_data_writer::release_committed_data() {
+    auto result = committed_data();
+    data_.erase(0, record_ends_.empty() ? 0 : record_ends_.back());
+    record_ends_.clear();
     return result;
 }
 
@@ -15,6 +15,8 @@
  */
 #pragma once
 
+#include <string>
+#include <string_view>
 #include <vector>
 
 #include <tateyama/api/server/writer.h>
@@ -30,15 +32,37 @@ public:
     tateyama::status write(const char *data, std::size_t length) override;
     tateyama::status commit() override;
 
-    // just for unit test
-    [[nodiscard]] std::vector<std::string> const& committed_data() const noexcept {
-        return committed_data_list_;
+    /**
+     * @brief accessor to the number of committed records
+     */
+    [[nodiscard]] std::size_t record_count() const noexcept {
+        return record_ends_.size();
+    }
+
+    /**
+     * @brief view of the i-th committed record, valid until the next write() or release
+     */
+    [[nodiscard]] std::string_view record(std::size_t i) const noexcept {
+        const auto begin = (i == 0) ? 0 : record_ends_[i - 1];
+        return { data_.data() + begin, record_ends_[i] - begin };  // NOLINT
     }
 
-    [[nodiscard]] std::vector<std::string> release_committed_data() noexcept;
+    // just for unit test
+    [[nodiscard]] std::vector<std::string> committed_data() const;
+
+    [[nodiscard]] std::vector<std::string> release_committed_data();
 private:
-    std::string current_data_ { };
-    std::vector<std::string> committed_data_list_ { };
+    // first reserves; skip the early doubling rounds of buffer growth
+    static constexpr std::size_t initial_data_capacity = 4096;
+    static constexpr std::size_t initial_commit_capacity = 64;
+
+    /*
+     * records are kept as one contiguous byte buffer plus the end offset of each
+     * committed record, so a write costs an append instead of a std::string per
+     * record; the bytes past the last end offset are the uncommitted ones
+     */
+    std::string data_ { };
+    std::vector<std::size_t> record_ends_ { };
 };
 
 } // namespace tateyama::endpoint::loopback
@@ -14,20 +14,22 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+
 #include "loopback_response.h"
 
 namespace tateyama::endpoint::loopback {
 
 tateyama::status loopback_response::acquire_channel(std::string_view name,
         std::shared_ptr<tateyama::api::server::data_channel> &ch) {
+    // construct the channel before taking the lock so the critical section is just the map insert
+    auto data_channel = std::make_shared<loopback_data_channel>(name);
     std::unique_lock<std::mutex> lock(mtx_channel_map_);
-    if (channel_map_.find(name) != channel_map_.cend()) {
+    if (auto [it, inserted] = channel_map_.try_emplace(data_channel->name(), data_channel); !inserted) {
         // already acquired the same name channel
         return tateyama::status::not_found;
     }
-    auto data_channel = std::make_shared<loopback_data_channel>(name);
-    ch = data_channel;
-    channel_map_.try_emplace(data_channel->name(), std::move(data_channel));
+    ch = std::move(data_channel);
     return tateyama::status::ok;
 }
 
@@ -45,13 +47,17 @@ tateyama::status loopback_response::release_channel(tateyama::api::server::data_
     }
     {
         std::unique_lock<std::mutex> lock(mtx_committed_data_map_);
-        committed_data_map_.try_emplace(name, data_channel->release_committed_data());
+        // keep the first release of a name, as try_emplace on the former map did
+        if (std::none_of(committed_data_map_.cbegin(), committed_data_map_.cend(),
+                         [&name](auto& entry){ return entry.first == name; })) {
+            committed_data_map_.emplace_back(name, data_channel->release_committed_data());
+        }
     }
     return tateyama::status::ok;
 }
 
-std::map<std::string, std::vector<std::string>, std::less<>> loopback_response::release_all_committed_data() noexcept {
-    std::map<std::string, std::vector<std::string>, std::less<>> result { };
+std::vector<std::pair<std::string, std::vector<std::string>>> loopback_response::release_all_committed_data() noexcept {
+    std::vector<std::pair<std::string, std::vector<std::string>>> result { };
     committed_data_map_.swap(result);
     return result;
 }
@@ -17,6 +17,8 @@
 
 #include <map>
 #include <mutex>
+#include <utility>
+#include <vector>
 
 #include <tateyama/api/server/response.h>
 
@@ -27,6 +29,8 @@ namespace tateyama::endpoint::loopback {
 
 class loopback_response: public tateyama::api::server::response {
 public:
+    using tateyama::api::server::response::body;
+
     /**
      * @see tateyama::server::response::session_id()
      */
@@ -58,6 +62,14 @@ public:
         return tateyama::status::ok;
     }
 
+    /**
+     * @see tateyama::server::response::body()
+     */
+    tateyama::status body(std::string&& body) override {
+        body_ = std::move(body);
+        return tateyama::status::ok;
+    }
+
     [[nodiscard]] std::string_view body() const noexcept {
         return body_;
     }
@@ -92,7 +104,7 @@ public:
     }
 
     // just for unit test
-    [[nodiscard]] std::map<std::string, std::vector<std::string>, std::less<>> const& all_committed_data() const noexcept {
+    [[nodiscard]] std::vector<std::pair<std::string, std::vector<std::string>>> const& all_committed_data() const noexcept {
         return committed_data_map_;
     }
 
@@ -103,7 +115,7 @@ public:
      * @post release_channel() of all acquired channels
      * @note this method is intended to call only once after all writing operations are finished clean
      */
-    [[nodiscard]] std::map<std::string, std::vector<std::string>, std::less<>> release_all_committed_data() noexcept;
+    [[nodiscard]] std::vector<std::pair<std::string, std::vector<std::string>>> release_all_committed_data() noexcept;
 
 private:
     std::size_t session_id_ { };
@@ -117,17 +129,22 @@ private:
      * @details add data_channel when acquired, remove it when it's released
      * @note it's empty if all data channels are released
      * @attention use mtx_channel_map_ to be thread-safe
+     * @note a plain mutex is the right tool here: the map has no read-only accessors, both
+     * operations mutate it, and the critical sections are a single insert or erase - a
+     * copy-on-write snapshot would add an allocation per mutation with no reader to benefit
      */
     std::map<std::string, std::shared_ptr<tateyama::api::server::data_channel>, std::less<>> channel_map_ { };
 
     std::mutex mtx_committed_data_map_ { };
     /*
      * @brief all committed data of all data channels
-     * Data queue is filled only when the channel is released
+     * Data queue is filled only when the channel is released.
+     * A flat vector of name/data pairs: channels per response are few, so appending beats a
+     * node-based map and release costs one amortized vector grow instead of a node allocation
      * @attention use mtx_committed_data_map_ to be thread-safe
      * @see notes of all_committed_data()
      */
-    std::map<std::string, std::vector<std::string>, std::less<>> committed_data_map_ { };
+    std::vector<std::pair<std::string, std::vector<std::string>>> committed_data_map_ { };
 };
 
 } // namespace tateyama::endpoint::loopback
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include <chrono>
+#include <utility>
 
 #include "stream_worker.h"
 
@@ -27,6 +28,18 @@ namespace tateyama::endpoint::stream::bootstrap {
 
 void stream_worker::run()  // NOLINT(readability-function-cognitive-complexity)
 {
+    // closes the session stream on every exit path, collapsing the close-and-return
+    // tails that were duplicated across the error branches; close() is idempotent
+    struct stream_guard {
+        explicit stream_guard(stream_socket& s) noexcept : socket_(s) {}
+        ~stream_guard() { socket_.close(); }
+        stream_guard(stream_guard const&) = delete;
+        stream_guard(stream_guard&&) = delete;
+        stream_guard& operator = (stream_guard const&) = delete;
+        stream_guard& operator = (stream_guard&&) = delete;
+        stream_socket& socket_;
+    } close_on_exit{*session_stream_};
+
     while (true) {
         std::uint16_t slot{};
         std::string payload{};
@@ -34,17 +47,16 @@ void stream_worker::run()  // NOLINT(readability-function-cognitive-complexity)
 
         case tateyama::endpoint::stream::stream_socket::await_result::payload:
         {
-            stream_request request_obj{*session_stream_, payload, database_info_, session_info_, session_store_};
-            stream_response response_obj{session_stream_, slot, [](){}};
+            stream_request request_obj{*session_stream_, std::move(payload), database_info_, session_info_, session_store_};
+            stream_response response_obj{session_stream_, slot, nullptr};
 
             if (decline_) {
                 notify_of_decline(&response_obj);
                 if (session_stream_->await(slot, payload) == tateyama::endpoint::stream::stream_socket::await_result::payload) {
                     LOG_LP(INFO) << "illegal procedure (receive a request in spite of a decline case)";  // should not reach here
                 } else {
-                    VLOG_LP(log_trace) << "session termination due to reaching the maximum number of sessions: session_id = " << std::to_string(session_id_);
+                    VLOG_LP(log_trace) << "session termination due to reaching the maximum number of sessions: session_id = " << session_id_str_;
                 }
-                session_stream_->close();
                 return;
             }
 
@@ -52,7 +64,6 @@ void stream_worker::run()  // NOLINT(readability-function-cognitive-complexity)
                 if (session_stream_->await(slot, payload) == tateyama::endpoint::stream::stream_socket::await_result::payload) {
                     LOG_LP(INFO) << "illegal termination of the session due to handshake error";  // should not reach here
                 }
-                session_stream_->close();
                 return;
             }
 
@@ -64,14 +75,13 @@ void stream_worker::run()  // NOLINT(readability-function-cognitive-complexity)
             continue;
 
         default:
-            session_stream_->close();
-            VLOG_LP(log_trace) << "received shutdown request: session_id = " << std::to_string(session_id_);
+            VLOG_LP(log_trace) << "received shutdown request: session_id = " << session_id_str_;
             return;
         }
         break;
     }
 
-    VLOG(log_debug_timing_event) << "/:tateyama:timing:session:started " << std::to_string(session_id_);
+    VLOG(log_debug_timing_event) << "/:tateyama:timing:session:started " << session_id_;
 #ifdef ENABLE_ALTIMETER
     const std::chrono::time_point session_start_time = std::chrono::high_resolution_clock::now();
     tateyama::endpoint::altimeter::session_start(database_info_, session_info_);
@@ -84,15 +94,13 @@ void stream_worker::run()  // NOLINT(readability-function-cognitive-complexity)
         switch (session_stream_->await(slot, payload)) {
         case tateyama::endpoint::stream::stream_socket::await_result::payload:
         {
-            auto request = std::make_shared<stream_request>(*session_stream_, payload, database_info_, session_info_, session_store_);
+            auto request = request_pool_.make_shared(*session_stream_, std::move(payload), database_info_, session_info_, session_store_);
             switch (request->service_id()) {
             case tateyama::framework::service_id_endpoint_broker:
             {
-                auto response = std::make_shared<stream_response>(session_stream_, slot, [](){});
+                auto response = response_pool_.make_shared(session_stream_, slot, nullptr);
                 // currently cancel request only
-                if (endpoint_service(std::dynamic_pointer_cast<tateyama::api::server::request>(request),
-                                     std::dynamic_pointer_cast<tateyama::endpoint::common::response>(response),
-                                     slot)) {
+                if (endpoint_service(request, response, slot)) {
                     continue;
                 }
                 VLOG_LP(log_info) << "terminate worker because endpoint service returns an error";
@@ -100,22 +108,20 @@ void stream_worker::run()  // NOLINT(readability-function-cognitive-complexity)
             }
             case tateyama::framework::service_id_routing:
             {
-                auto response = std::make_shared<stream_response>(session_stream_, slot, [this, slot](){remove_reqres(slot);});
-                register_reqres(slot,
-                                std::dynamic_pointer_cast<tateyama::api::server::request>(request),
-                                std::dynamic_pointer_cast<tateyama::endpoint::common::response>(response));
-                if (routing_service_chain(std::dynamic_pointer_cast<tateyama::api::server::request>(request),
-                                          std::dynamic_pointer_cast<tateyama::api::server::response>(response),
-                                          slot)) {
+                auto response = response_pool_.make_shared(session_stream_, slot, this);
+                // bind the upcast once; each implicit conversion costs a refcount pair
+                std::shared_ptr<tateyama::api::server::request> request_api = request;
+                std::shared_ptr<tateyama::api::server::response> response_api = response;
+                register_reqres(slot, request_api, response);
+                if (routing_service_chain(request_api, response_api, slot)) {
                     care_reqreses();
                     if (check_shutdown_request() && is_completed()) {
                         shutdown_complete();
-                        VLOG_LP(log_trace) << "received and completed shutdown request: session_id = " << std::to_string(session_id_);
+                        VLOG_LP(log_trace) << "received and completed shutdown request: session_id = " << session_id_str_;
                     }
                     continue;
                 }
-                if (service_(std::dynamic_pointer_cast<tateyama::api::server::request>(request),
-                             std::dynamic_pointer_cast<tateyama::api::server::response>(response))) {
+                if (service_(request_api, response_api)) {
                     continue;
                 }
                 VLOG_LP(log_info) << "terminate worker because service returns an error";
@@ -123,13 +129,11 @@ void stream_worker::run()  // NOLINT(readability-function-cognitive-complexity)
             }
             default:
             {
-                auto response = std::make_shared<stream_response>(session_stream_, slot, [this, slot](){remove_reqres(slot);});
+                auto response = response_pool_.make_shared(session_stream_, slot, this);
                 if (!check_shutdown_request()) {
-                    register_reqres(slot,
-                                    std::dynamic_pointer_cast<tateyama::api::server::request>(request),
-                                    std::dynamic_pointer_cast<tateyama::endpoint::common::response>(response));
-                    if(service_(std::dynamic_pointer_cast<tateyama::api::server::request>(request),
-                                std::dynamic_pointer_cast<tateyama::api::server::response>(response))) {
+                    std::shared_ptr<tateyama::api::server::request> request_api = request;
+                    register_reqres(slot, request_api, response);
+                    if(service_(request_api, response)) {
                         continue;
                     }
                     VLOG_LP(log_info) << "terminate worker because service returns an error";
@@ -146,7 +150,7 @@ void stream_worker::run()  // NOLINT(readability-function-cognitive-complexity)
         case tateyama::endpoint::stream::stream_socket::await_result::timeout:
             care_reqreses();
             if (check_shutdown_request() && is_completed()) {
-                VLOG_LP(log_trace) << "received and completed shutdown request: session_id = " << std::to_string(session_id_);
+                VLOG_LP(log_trace) << "received and completed shutdown request: session_id = " << session_id_str_;
                 shutdown_complete();
                 if (!shutdown_from_client()) {
                     break;
@@ -172,7 +176,6 @@ void stream_worker::run()  // NOLINT(readability-function-cognitive-complexity)
         }
         break;
     }
-    session_stream_->close();
 
 #ifdef ENABLE_ALTIMETER
     tateyama::endpoint::altimeter::session_end(database_info_, session_info_, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - session_start_time).count());
@@ -181,7 +184,7 @@ void stream_worker::run()  // NOLINT(readability-function-cognitive-complexity)
 }
 
 bool stream_worker::terminate(tateyama::session::shutdown_request_type type) {
-    VLOG_LP(log_trace) << "send terminate request: session_id = " << std::to_string(session_id_);
+    VLOG_LP(log_trace) << "send terminate request: session_id = " << session_id_str_;
 
     return request_shutdown(type);
 }
@@ -18,10 +18,16 @@
 #include <future>
 #include <thread>
 
+#include "tateyama/endpoint/common/object_pool.h"
 #include "tateyama/endpoint/common/worker_common.h"
 
 #include "tateyama/endpoint/stream/stream.h"
 
+namespace tateyama::endpoint::stream {
+class stream_request;
+class stream_response;
+}
+
 namespace tateyama::endpoint::stream::bootstrap {
 
 class alignas(64) stream_worker : public tateyama::endpoint::common::worker_common {
@@ -46,19 +52,35 @@ class alignas(64) stream_worker : public tateyama::endpoint::common::worker_comm
     bool terminate(tateyama::session::shutdown_request_type type);
     [[nodiscard]] std::size_t session_id() const noexcept { return session_id_; }
 
+    /**
+     * @brief release the reqres table entry of the given slot, called by stream_response on completion
+     */
+    void release_reqres(std::uint16_t slot) noexcept {
+        remove_reqres(slot);
+    }
+
  private:
     tateyama::framework::routing_service& service_;
     std::shared_ptr<stream_socket> session_stream_;
     const tateyama::api::server::database_info& database_info_;
     const bool decline_;
 
-    void notify_of_decline(tateyama::api::server::response* response) {
-        tateyama::proto::endpoint::response::Handshake rp{};
-        auto re = rp.mutable_error();
-        re->set_message("requests for session connections exceeded the maximum number of sessions");
-        re->set_code(tateyama::proto::diagnostics::Code::RESOURCE_LIMIT_REACHED);
-        response->body(rp.SerializeAsString());
-        rp.clear_error();
+    // recycle the request/response allocations of the per-message dispatch in run();
+    // sized to the number of result-set slots, the most objects live at one time
+    tateyama::endpoint::common::object_pool<stream_request> request_pool_{};
+    tateyama::endpoint::common::object_pool<stream_response> response_pool_{};
+
+    __attribute__((cold)) void notify_of_decline(tateyama::api::server::response* response) {
+        // the reply is a fixed error, so it is serialized once and reused; under a
+        // connection storm against a saturated server this is all a worker does
+        static std::string const body = []{
+            tateyama::proto::endpoint::response::Handshake rp{};
+            auto re = rp.mutable_error();
+            re->set_message("requests for session connections exceeded the maximum number of sessions");
+            re->set_code(tateyama::proto::diagnostics::Code::RESOURCE_LIMIT_REACHED);
+            return rp.SerializeAsString();
+        }();
+        response->body(body);
     }
 
     bool has_incomplete_resultset() override {
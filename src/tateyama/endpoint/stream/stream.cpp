@@ -26,6 +26,15 @@ stream_socket::stream_socket(int socket, std::string_view info, connection_socke
     if (setsockopt(socket, SOL_TCP, TCP_NODELAY, &enable, sizeof(enable)) < 0) {
         LOG_LP(ERROR) << "setsockopt() fail";
     }
+#ifdef SO_BUSY_POLL
+    // best effort: lets recv()/poll() busy-wait briefly before sleeping, saving the
+    // wakeup round trip for small RPC frames; the kernel may refuse this without
+    // CAP_NET_ADMIN, and net.core.busy_poll governs the system-wide behavior
+    const int busy_poll_usec = 50;
+    if (setsockopt(socket, SOL_SOCKET, SO_BUSY_POLL, &busy_poll_usec, sizeof(busy_poll_usec)) < 0) {
+        VLOG_LP(log_debug) << "SO_BUSY_POLL is not available, continuing without busy polling";
+    }
+#endif
     in_use_.resize(slot_size_);
     envelope_->num_open_.fetch_add(1);
 }
@@ -17,9 +17,11 @@
 
 #include <sys/types.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
 #include <unistd.h>
+#include <cerrno>
 #include <cstdlib>
 #include <sys/poll.h>
 #include <memory>
@@ -78,6 +80,9 @@ class stream_socket
         [[nodiscard]] std::string payload() const {
             return payload_;
         }
+        [[nodiscard]] std::string release_payload() {
+            return std::move(payload_);
+        }
     private:
         unsigned char info_;
         std::uint16_t slot_;
@@ -153,14 +158,13 @@ public:
         if (session_closed_) {
             return;
         }
-        unsigned char info = RESPONSE_RESULT_SET_PAYLOAD;
-        ::send(socket_, &info, 1, MSG_NOSIGNAL);
-        char buffer[sizeof(std::uint16_t)];  // NOLINT
-        buffer[0] = slot & 0xff;  // NOLINT
-        buffer[1] = (slot / 0x100) & 0xff;  // NOLINT
-        ::send(socket_, &buffer[0], sizeof(std::uint16_t), MSG_MORE | MSG_NOSIGNAL);
-        ::send(socket_, &writer, 1, MSG_MORE | MSG_NOSIGNAL);
-        send_payload(payload);
+        char header[8];  // NOLINT
+        header[0] = static_cast<char>(RESPONSE_RESULT_SET_PAYLOAD);  // NOLINT
+        header[1] = slot & 0xff;  // NOLINT
+        header[2] = (slot / 0x100) & 0xff;  // NOLINT
+        header[3] = static_cast<char>(writer);  // NOLINT
+        set_payload_length(&header[4], payload.length());  // NOLINT
+        send_frame(&header[0], sizeof(header), payload);  // NOLINT
     }
 
     void close() {
@@ -226,34 +230,47 @@ private:
         fds_[0].revents = 0;                // NOLINT
         while (true) {
             if (!queue_.empty() && slot_using_ < slot_size_) {
-                auto entry = queue_.front();
+                auto& entry = queue_.front();
                 info = entry.info();
                 slot = entry.slot();
-                payload = entry.payload();
+                payload = entry.release_payload();  // move, not copy - the entry is popped next
                 queue_.pop();
                 return await_result::payload;
             }
 
-            if (auto rv = poll(fds_, N_FDS, TIMEOUT_MS); !(rv > 0)) {  // NOLINT
-                if (rv == 0) {
-                    return await_result::timeout;
-                }
-                throw std::runtime_error("error in poll");
-            }
-
-            if (fds_[0].revents & POLLPRI) {  // NOLINT
-                unsigned char buf{};
-                if (::recv (socket_, &buf, 1, MSG_OOB) < 0) {
+            // fast path for a loaded session: when the next frame is already in the socket
+            // buffer, read its header without paying the poll syscall per message
+            if (auto size_i = ::recv(socket_, &info, 1, MSG_DONTWAIT); size_i == 0) {
+                DVLOG_LP(log_trace) << "socket is closed by the client";
+                return await_result::socket_closed;
+            } else if (size_i < 0) {  // NOLINT(readability-else-after-return)
+                if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                    DVLOG_LP(log_trace) << "socket is closed by the client abnormally";
                     return await_result::socket_closed;
                 }
-                return await_result::timeout;
-            }
-            if (fds_[0].revents & POLLIN) {  // NOLINT
-                if (auto size_i = ::recv(socket_, &info, 1, 0); size_i == 0) {
-                    DVLOG_LP(log_trace) << "socket is closed by the client";
-                    return await_result::socket_closed;
+
+                if (auto rv = poll(fds_, N_FDS, TIMEOUT_MS); !(rv > 0)) {  // NOLINT
+                    if (rv == 0) {
+                        return await_result::timeout;
+                    }
+                    throw std::runtime_error("error in poll");
                 }
 
+                if (fds_[0].revents & POLLPRI) {  // NOLINT
+                    unsigned char buf{};
+                    if (::recv (socket_, &buf, 1, MSG_OOB) < 0) {
+                        return await_result::socket_closed;
+                    }
+                    return await_result::timeout;
+                }
+                if (fds_[0].revents & POLLIN) {  // NOLINT
+                    if (auto size_i_p = ::recv(socket_, &info, 1, 0); size_i_p == 0) {
+                        DVLOG_LP(log_trace) << "socket is closed by the client";
+                        return await_result::socket_closed;
+                    }
+                }
+            }
+            {
                 char buffer[sizeof(std::uint16_t)];  // NOLINT
                 if (!recv(&buffer[0], sizeof(std::uint16_t))) {
                         DVLOG_LP(log_trace) << "socket is closed by the client abnormally";
@@ -268,7 +285,7 @@ private:
                     if (slot_using_ < slot_size_) {
                         return await_result::payload;
                     }
-                    queue_.push(recv_entry(info, slot, payload));
+                    queue_.push(recv_entry(info, slot, std::move(payload)));
                     break;
                 }
                 DVLOG_LP(log_trace) << "socket is closed by the client abnormally";
@@ -345,30 +362,35 @@ private:
     }
 
     void send_response(unsigned char info, std::uint16_t slot, std::string_view payload, bool force = false) {  // a support function, assumes caller hold lock
-        char buffer[sizeof(std::uint16_t)];  // NOLINT
+        char header[7];  // NOLINT
         std::unique_lock<std::mutex> lock(mutex_);
         if (session_closed_ && !force) {
             return;
         }
-        ::send(socket_, &info, 1, MSG_NOSIGNAL);
-        buffer[0] = slot & 0xff;  // NOLINT
-        buffer[1] = (slot / 0x100) & 0xff;  // NOLINT
-        ::send(socket_, &buffer[0], sizeof(std::uint16_t), MSG_MORE | MSG_NOSIGNAL);
-        send_payload(payload);
+        header[0] = static_cast<char>(info);  // NOLINT
+        header[1] = slot & 0xff;  // NOLINT
+        header[2] = (slot / 0x100) & 0xff;  // NOLINT
+        set_payload_length(&header[3], payload.length());  // NOLINT
+        send_frame(&header[0], sizeof(header), payload);  // NOLINT
     }
-    void send_payload(std::string_view payload) const {  // a support function, assumes caller hold lock
-        unsigned int length = payload.length();
-        char buffer[4];  // NOLINT
+    static void set_payload_length(char* buffer, unsigned int length) {  // a support function
         buffer[0] = length & 0xff;  // NOLINT
         buffer[1] = (length / 0x100) & 0xff;  // NOLINT
         buffer[2] = (length / 0x10000) & 0xff;  // NOLINT
         buffer[3] = (length / 0x1000000) & 0xff;  // NOLINT
-        if (length > 0) {
-            ::send(socket_, &buffer[0], sizeof(length), MSG_MORE | MSG_NOSIGNAL);
-            ::send(socket_, payload.data(), length, MSG_NOSIGNAL);
-        } else {
-            ::send(socket_, &buffer[0], sizeof(length), MSG_NOSIGNAL);
-        }
+    }
+    // emits a whole frame with one sendmsg(), where separate send() calls per header field
+    // cost a syscall each and could put the info byte on the wire as its own packet
+    void send_frame(const char* header, std::size_t header_length, std::string_view payload) const {  // a support function, assumes caller hold lock
+        iovec vec[2];  // NOLINT
+        vec[0].iov_base = const_cast<char*>(header);  // NOLINT
+        vec[0].iov_len = header_length;
+        vec[1].iov_base = const_cast<char*>(payload.data());  // NOLINT
+        vec[1].iov_len = payload.length();
+        msghdr msg{};
+        msg.msg_iov = &vec[0];  // NOLINT
+        msg.msg_iovlen = payload.empty() ? 1 : 2;
+        ::sendmsg(socket_, &msg, MSG_NOSIGNAL);
     }
 
     void release_slot(unsigned int slot) {
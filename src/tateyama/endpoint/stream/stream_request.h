@@ -15,12 +15,17 @@
  */
 #pragma once
 
+#include <string>
 #include <string_view>
 
+#include <glog/logging.h>
+
+#include <tateyama/logging.h>
 #include <tateyama/endpoint/common/request.h>
 
 #include "stream.h"
 #include "tateyama/endpoint/common/endpoint_proto_utils.h"
+#include "tateyama/logging_helper.h"
 
 namespace tateyama::endpoint::stream {
 
@@ -30,22 +35,35 @@ namespace tateyama::endpoint::stream {
 class alignas(64) stream_request : public tateyama::endpoint::common::request {
 public:
     stream_request() = delete;
-    explicit stream_request(stream_socket& session_socket, std::string& payload, const tateyama::api::server::database_info& database_info, const tateyama::api::server::session_info& session_info, tateyama::api::server::session_store& session_store)
-        : tateyama::endpoint::common::request(database_info, session_info, session_store), session_socket_(session_socket) {
+    explicit stream_request(stream_socket& session_socket, std::string message, const tateyama::api::server::database_info& database_info, const tateyama::api::server::session_info& session_info, tateyama::api::server::session_store& session_store)
+        : tateyama::endpoint::common::request(database_info, session_info, session_store), session_socket_(session_socket), message_(std::move(message)) {
         endpoint::common::parse_result res{};
-        endpoint::common::parse_header(payload, res); // TODO handle error
+        endpoint::common::parse_header(message_, res); // TODO handle error
         payload_ = res.payload_;
         session_id_ = res.session_id_;
         service_id_ = res.service_id_;
     }
 
-    [[nodiscard]] std::string_view payload() const override;
-    [[nodiscard]] std::size_t session_id() const override;
-    [[nodiscard]] std::size_t service_id() const override;
+    // accessors are defined inline so the hot dispatch path does not cross a translation unit boundary
+    [[nodiscard]] std::string_view payload() const override {
+        VLOG_LP(log_trace) << static_cast<const void*>(&session_socket_) << " length = " << payload_.length();  //NOLINT
+        return payload_;
+    }
+
+    [[nodiscard]] std::size_t session_id() const override {
+        return session_id_;
+    }
+
+    [[nodiscard]] std::size_t service_id() const override {
+        return service_id_;
+    }
 
 private:
     stream_socket& session_socket_;
 
+    // the request takes the received message over from the worker loop, so payload_ stays
+    // valid for services that keep the request registered past the dispatch iteration
+    std::string message_;
     std::string_view payload_{};
     std::size_t session_id_{};
     std::size_t service_id_{};
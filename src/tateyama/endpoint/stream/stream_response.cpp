@@ -23,6 +23,7 @@
 
 #include "stream_response.h"
 #include "tateyama/endpoint/common/endpoint_proto_utils.h"
+#include "tateyama/endpoint/stream/bootstrap/stream_worker.h"
 
 namespace tateyama::endpoint::stream {
 
@@ -43,11 +44,11 @@ tateyama::status stream_response::body(std::string_view body) {
         }
         auto s = ss.str();
         stream_->send(index_, s, true);
-        clean_up_();
+        release_slot();
         return tateyama::status::ok;
     }
     LOG_LP(ERROR) << "response is already completed";
-    clean_up_();
+    release_slot();
     return status::unknown;        
 }
 
@@ -81,7 +82,13 @@ void stream_response::error(proto::diagnostics::Record const& record) {
     } else {
         LOG_LP(ERROR) << "response is already completed";
     }
-    clean_up_();
+    release_slot();
+}
+
+void stream_response::release_slot() {
+    if (owner_ != nullptr) {
+        owner_->release_reqres(index_);
+    }
 }
 
 void stream_response::server_diagnostics(std::string_view diagnostic_record) {
@@ -25,6 +25,10 @@
 #include "tateyama/endpoint/common/pointer_comp.h"
 #include "stream.h"
 
+namespace tateyama::endpoint::stream::bootstrap {
+class stream_worker;
+}
+
 namespace tateyama::endpoint::stream {
 
 class stream_socket;
@@ -77,10 +81,15 @@ class alignas(64) stream_response : public tateyama::endpoint::common::response
     friend stream_data_channel;
 
 public:
-    stream_response(std::shared_ptr<stream_socket> stream, std::uint16_t index, std::function<void(void)> clean_up) :
+    /**
+     * @brief create a response object for the message at the given slot
+     * @param owner the worker whose reqres table entry for the slot is released on completion,
+     * or nullptr when the slot is not registered there
+     */
+    stream_response(std::shared_ptr<stream_socket> stream, std::uint16_t index, bootstrap::stream_worker* owner) :
         tateyama::endpoint::common::response(index),
         stream_(std::move(stream)),
-        clean_up_(std::move(clean_up)) {
+        owner_(owner) {
     }
 
     tateyama::status body(std::string_view body) override;
@@ -91,9 +100,12 @@ public:
 
 private:
     std::shared_ptr<stream_socket> stream_;
-    const std::function<void(void)> clean_up_;
+    // a slot token instead of a clean-up std::function: the worker pointer plus index_
+    // identify the reqres table entry, avoiding a capture allocation per response
+    bootstrap::stream_worker* owner_;
 
     void server_diagnostics(std::string_view diagnostic_record);
+    void release_slot();
 };
 
 }
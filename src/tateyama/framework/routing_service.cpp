@@ -87,7 +87,7 @@ static bool service_(
     }
 }
 
-bool routing_service::operator()(std::shared_ptr<request> req, std::shared_ptr<response> res) {
+bool routing_service::operator()(std::shared_ptr<request> const& req, std::shared_ptr<response> const& res) {
     if (services_ == nullptr) {
         LOG_LP(ERROR) << "routing service is not setup, or framework is running on standalone mode";
         return false;
@@ -97,7 +97,7 @@ bool routing_service::operator()(std::shared_ptr<request> req, std::shared_ptr<r
         return service_(req, res);
     }
     if (auto destination = services_->find_by_id(req->service_id()); destination != nullptr) {
-        destination->operator()(std::move(req), std::move(res));
+        destination->operator()(req, res);
         return true;
     }
 
@@ -15,11 +15,13 @@
  */
 #include <tateyama/loopback/buffered_response.h>
 
+#include <algorithm>
+
 namespace tateyama::loopback {
 
 buffered_response::buffered_response(std::size_t session_id,
         std::string_view body_head, std::string_view body,
-        std::map<std::string, std::vector<std::string>, std::less<>> &&data_map) :
+        std::vector<std::pair<std::string, std::vector<std::string>>> &&data_map) :
         session_id_(session_id), body_head_(body_head), body_(body), data_map_(std::move(data_map)) {
 }
 
@@ -40,13 +42,14 @@ std::string_view buffered_response::body() const noexcept {
 }
 
 bool buffered_response::has_channel(std::string_view name) const noexcept {
-    return data_map_.find(name) != data_map_.cend();
+    return std::any_of(data_map_.cbegin(), data_map_.cend(), [name](auto& entry){ return entry.first == name; });
 }
 
 std::vector<std::string> const& buffered_response::channel(std::string_view name) const {
-    auto it = data_map_.find(name);
-    if (it != data_map_.cend()) {
-        return it->second;
+    for (auto& entry : data_map_) {
+        if (entry.first == name) {
+            return entry.second;
+        }
     }
     throw std::invalid_argument("invalid channel name: " + std::string { name });
 }
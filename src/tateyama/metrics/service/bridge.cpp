@@ -45,7 +45,7 @@ bool bridge::shutdown(environment&) {
     return true;
 }
 
-bool bridge::operator()(std::shared_ptr<request> req, std::shared_ptr<response> res) {
+bool bridge::operator()(std::shared_ptr<request> const& req, std::shared_ptr<response> const& res) {
     return core_->operator()(req, res);
 }
 
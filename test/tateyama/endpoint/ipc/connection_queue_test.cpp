@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include "ipc_gtest_base.h"
+#include "tateyama/endpoint/shm_utils.h"
 
 #include <vector>
 #include <cstdint>
@@ -78,7 +79,7 @@ class connection_queue_test : public ::testing::Test {
     };
 
     virtual void SetUp() {
-        rv_ = system("if [ -f /dev/shm/connection_queue_test ]; then rm -f /dev/shm/connection_queue_test; fi");
+        remove_shm_entry("connection_queue_test");
         container_ = std::make_unique < tateyama::endpoint::ipc::bootstrap::connection_container > (database_name, threads, admin_sessions);
         listener_ = std::make_unique < listener > (*container_);
         listener_thread_ = std::thread(std::ref(*listener_));
@@ -87,10 +88,9 @@ class connection_queue_test : public ::testing::Test {
     virtual void TearDown() {
         container_->get_connection_queue().request_terminate();
         listener_thread_.join();
-        rv_ = system("if [ -f /dev/shm/connection_queue_test ]; then rm -f /dev/shm/connection_queue_test; fi");
+        remove_shm_entry("connection_queue_test");
     }
 
-    int rv_;
 
 protected:
     std::size_t connect(std::size_t& slot) {
@@ -26,8 +26,8 @@ public:
         EXPECT_GT(res_len_list_.size(), 0);
     }
 
-    bool operator ()(std::shared_ptr<tateyama::api::server::request> req,
-            std::shared_ptr<tateyama::api::server::response> res) override {
+    bool operator ()(std::shared_ptr<tateyama::api::server::request> const& req,
+            std::shared_ptr<tateyama::api::server::response> const& res) override {
         size_t req_len = req_len_list_[(index_ / res_len_list_.size()) % req_len_list_.size()];
         size_t res_len = res_len_list_[index_ % res_len_list_.size()];
         index_++;
@@ -25,8 +25,8 @@ public:
         EXPECT_GT(len_list_.size(), 0);
     }
 
-    bool operator ()(std::shared_ptr<tateyama::api::server::request> req,
-            std::shared_ptr<tateyama::api::server::response> res) override {
+    bool operator ()(std::shared_ptr<tateyama::api::server::request> const& req,
+            std::shared_ptr<tateyama::api::server::response> const& res) override {
         size_t req_len = len_list_[index_ % len_list_.size()];
         index_++;
         // make another string object to reply
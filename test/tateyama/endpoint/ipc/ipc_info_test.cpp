@@ -20,6 +20,8 @@
 #include "tateyama/status/resource/database_info_impl.h"
 #include "ipc_client.h"
 
+#include "tateyama/endpoint/shm_utils.h"
+
 #include <gtest/gtest.h>
 
 namespace tateyama::server {
@@ -58,8 +60,8 @@ public:
     std::string_view label() const noexcept { return __func__; }
 
     id_type id() const noexcept { return service_id_of_info_service; }
-    bool operator ()(std::shared_ptr<tateyama::api::server::request> req,
-                     std::shared_ptr<tateyama::api::server::response> res) override {
+    bool operator ()(std::shared_ptr<tateyama::api::server::request> const& req,
+                     std::shared_ptr<tateyama::api::server::response> const& res) override {
         req_ = req;
         res->body(response_test_message);
         return true;
@@ -75,14 +77,13 @@ private:
 
 class ipc_info_test : public ::testing::Test {
     virtual void SetUp() {
-        rv_ = system("if [ -f /dev/shm/ipc_info_test ]; then rm -f /dev/shm/ipc_info_test; fi");
+        remove_shm_entry("ipc_info_test");
     }
 
     virtual void TearDown() {
-        rv_ = system("if [ -f /dev/shm/ipc_info_test ]; then rm -f /dev/shm/ipc_info_test; fi");
+        remove_shm_entry("ipc_info_test");
     }
 
-    int rv_;
 
 public:
     tateyama::status_info::resource::database_info_impl database_info_{database_name};
@@ -20,8 +20,8 @@ namespace tateyama::endpoint::ipc {
 
 class multi_clients_service: public server_service_base {
 public:
-    bool operator ()(std::shared_ptr<tateyama::api::server::request> req,
-            std::shared_ptr<tateyama::api::server::response> res) override {
+    bool operator ()(std::shared_ptr<tateyama::api::server::request> const& req,
+            std::shared_ptr<tateyama::api::server::response> const& res) override {
         std::string req_message { req->payload() };
         res->session_id(req->session_id());
         EXPECT_EQ(tateyama::status::ok, res->body(req_message));
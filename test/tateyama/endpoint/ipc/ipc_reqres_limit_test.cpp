@@ -27,8 +27,8 @@ public:
         EXPECT_EQ(req_len_list_.size(), res_len_list_.size());
     }
 
-    bool operator ()(std::shared_ptr<tateyama::api::server::request> req,
-            std::shared_ptr<tateyama::api::server::response> res) override {
+    bool operator ()(std::shared_ptr<tateyama::api::server::request> const& req,
+            std::shared_ptr<tateyama::api::server::response> const& res) override {
         thread_local int index_ = 0;
         size_t req_len = req_len_list_[(index_ / res_len_list_.size()) % req_len_list_.size()];
         size_t res_len = res_len_list_[index_ % res_len_list_.size()];
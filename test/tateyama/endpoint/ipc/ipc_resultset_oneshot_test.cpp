@@ -21,8 +21,8 @@ static const std::string resultset_name { "resultset_1" }; // NOLINT
 
 class resultset_oneshot_service: public server_service_base {
 public:
-    bool operator ()(std::shared_ptr<tateyama::api::server::request> req,
-            std::shared_ptr<tateyama::api::server::response> res) override {
+    bool operator ()(std::shared_ptr<tateyama::api::server::request> const& req,
+            std::shared_ptr<tateyama::api::server::response> const& res) override {
         std::string payload { req->payload() };
         std::size_t datalen = std::stoul(payload);
         std::shared_ptr<tateyama::api::server::data_channel> channel;
@@ -37,16 +37,11 @@ public:
         std::string data;
         make_dummy_message(req->session_id(), datalen, data);
         EXPECT_EQ(datalen, data.length());
-        std::cout << "server : call write() : " << datalen << std::endl;
         EXPECT_EQ(tateyama::status::ok, writer->write(data.c_str(), data.length()));
-        std::cout << "server : call commit()" << std::endl;
         EXPECT_EQ(tateyama::status::ok, writer->commit());
-        std::cout << "server : commit done()" << std::endl;
         //
         EXPECT_EQ(tateyama::status::ok, channel->release(*writer));
-        std::cout << "server : release() done" << std::endl;
         EXPECT_EQ(tateyama::status::ok, res->release_channel(*channel));
-        std::cout << "server : release_channel() done" << std::endl;
         return true;
     }
 };
@@ -80,15 +75,12 @@ public:
         // NOTE: One call of writer->write(data, len) (>= 16KB or so) may be gotten
         // by more than one get_chunk(). You should concatenate every chunk data.
         while (data.length() < datalen_) {
-            std::cout << "client : call get_chunk()" << std::endl;
             std::string_view chunk = rwc->get_chunk();
-            std::cout << "client : get_chunk() done : " << chunk.length() << std::endl;
             if (chunk.length() == 0) {
                 break;
             }
             data += chunk;
             rwc->dispose();
-            std::cout << "client : dispose() done" << std::endl;
         }
         // just wait until is_eor() is true
         while (!rwc->is_eor()) {
@@ -20,8 +20,8 @@ namespace tateyama::endpoint::ipc {
 
 class resultset_writer_limit_service: public server_service_base {
 public:
-    bool operator ()(std::shared_ptr<tateyama::api::server::request> req,
-            std::shared_ptr<tateyama::api::server::response> res) override {
+    bool operator ()(std::shared_ptr<tateyama::api::server::request> const& req,
+            std::shared_ptr<tateyama::api::server::response> const& res) override {
         std::string payload { req->payload() };
         resultset_param param { payload };
         EXPECT_GT(param.name_.length(), 0);
@@ -19,8 +19,8 @@ namespace tateyama::endpoint::ipc {
 
 class session_limit_service: public server_service_base {
 public:
-    bool operator ()(std::shared_ptr<tateyama::api::server::request> req,
-            std::shared_ptr<tateyama::api::server::response> res) override {
+    bool operator ()(std::shared_ptr<tateyama::api::server::request> const& req,
+            std::shared_ptr<tateyama::api::server::response> const& res) override {
         std::string payload { req->payload() };
         res->session_id(req->session_id());
         EXPECT_EQ(tateyama::status::ok, res->body(payload));
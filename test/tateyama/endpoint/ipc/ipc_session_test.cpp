@@ -25,6 +25,8 @@
 #include <tateyama/session/resource/bridge.h>
 #include "ipc_client.h"
 
+#include "tateyama/endpoint/shm_utils.h"
+
 #include <gtest/gtest.h>
 
 namespace tateyama::server {
@@ -59,8 +61,8 @@ public:
     bool shutdown(tateyama::framework::environment&) { return true; }
 
     id_type id() const noexcept { return service_id_of_session_service;  }
-    bool operator ()(std::shared_ptr<tateyama::api::server::request> req,
-                     std::shared_ptr<tateyama::api::server::response> res) override {
+    bool operator ()(std::shared_ptr<tateyama::api::server::request> const& req,
+                     std::shared_ptr<tateyama::api::server::response> const& res) override {
         req_ = req;
         res_ = res;
         // do not respond to the request message here in this test
@@ -110,7 +112,7 @@ class ipc_session_test : public ::testing::Test {
     static constexpr std::size_t writer_count = 8;
 
     virtual void SetUp() {
-        rv_ = system("if [ -f /dev/shm/ipc_session_test ]; then rm -f /dev/shm/ipc_session_test; fi");
+        remove_shm_entry("ipc_session_test");
 
         // server part
         std::string session_name{database_name};
@@ -128,10 +130,9 @@ class ipc_session_test : public ::testing::Test {
     virtual void TearDown() {
         tateyama::server::ipc_listener_for_session_test::wait(*worker_);
 
-        rv_ = system("if [ -f /dev/shm/ipc_session_test ]; then rm -f /dev/shm/ipc_session_test; fi");
+        remove_shm_entry("ipc_session_test");
     }
 
-    int rv_;
 
 protected:
     tateyama::status_info::resource::database_info_impl database_info_{database_name};
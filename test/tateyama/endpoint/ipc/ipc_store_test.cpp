@@ -24,6 +24,8 @@
 #include "tateyama/status/resource/database_info_impl.h"
 #include "ipc_client.h"
 
+#include "tateyama/endpoint/shm_utils.h"
+
 #include <gtest/gtest.h>
 
 namespace tateyama::server {
@@ -63,8 +65,8 @@ public:
     std::string_view label() const noexcept { return __func__; }
 
     id_type id() const noexcept { return service_id_of_store_service; }
-    bool operator ()(std::shared_ptr<tateyama::api::server::request> req,
-                     std::shared_ptr<tateyama::api::server::response> res) override {
+    bool operator ()(std::shared_ptr<tateyama::api::server::request> const& req,
+                     std::shared_ptr<tateyama::api::server::response> const& res) override {
         req_ = req;
         res->body(response_test_message);
         return true;
@@ -82,7 +84,7 @@ class ipc_store_test : public ::testing::Test {
     static constexpr std::size_t writer_count = 8;
 
     virtual void SetUp() {
-        rv_ = system("if [ -f /dev/shm/ipc_store_test ]; then rm -f /dev/shm/ipc_store_test; fi");
+        remove_shm_entry("ipc_store_test");
         // server part
         std::string session_name{database_name};
         session_name += "-";
@@ -98,10 +100,9 @@ class ipc_store_test : public ::testing::Test {
 
     virtual void TearDown() {
         tateyama::server::ipc_listener_for_store_test::wait(*worker_);
-        rv_ = system("if [ -f /dev/shm/ipc_store_test ]; then rm -f /dev/shm/ipc_store_test; fi");
+        remove_shm_entry("ipc_store_test");
     }
 
-    int rv_;
 
 protected:
     tateyama::status_info::resource::database_info_impl database_info_{database_name};
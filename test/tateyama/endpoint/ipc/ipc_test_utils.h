@@ -131,8 +131,8 @@ public:
         return true;
     }
 
-    virtual bool operator ()(std::shared_ptr<tateyama::api::server::request> req,
-                             std::shared_ptr<tateyama::api::server::response> res) = 0;
+    virtual bool operator ()(std::shared_ptr<tateyama::api::server::request> const& req,
+                             std::shared_ptr<tateyama::api::server::response> const& res) = 0;
 
     [[nodiscard]] std::string_view label() const noexcept override {
         return "server_service_base";
@@ -27,6 +27,7 @@
 
 namespace tateyama::endpoint::ipc {
 
+#ifdef TATEYAMA_TEST_USE_FORK
 /*
  *  see https://github.com/google/googletest/issues/1153 for using fork() in GTEST
  */
@@ -46,6 +47,15 @@ void server_client_base::wait_client_exit() {
         check_client_exitcode(wait_for_child_fork(pid));
     }
 }
+#else
+void server_client_base::wait_client_exit() {
+    for (std::thread &th : client_threads_) {
+        if (th.joinable()) {
+            th.join();
+        }
+    }
+}
+#endif
 
 void server_client_base::server() {
     tateyama::framework::server sv { tateyama::framework::boot_mode::database_server, cfg_ };
@@ -81,21 +91,23 @@ void server_client_base::client() {
         client_thread();
         return;
     }
-    //
-    threads_.clear();
-    threads_.reserve(nthread_);
+    // local, so that concurrent clients of the thread-per-client mode do not share state
+    std::vector<std::thread> workers { };
+    workers.reserve(nthread_);
     for (int i = 0; i < nthread_; i++) {
-        threads_.emplace_back([this] {
+        workers.emplace_back([this] {
             client_thread();
         });
     }
-    for (std::thread &th : threads_) {
+    for (std::thread &th : workers) {
         if (th.joinable()) {
             th.join();
         }
     }
 }
 
+#ifdef TATEYAMA_TEST_USE_FORK
+
 void server_client_base::start_server_client() {
     server_startup_start(); // call this before fork()
     for (int i = 0; i < nproc_; i++) {
@@ -153,4 +165,33 @@ void server_client_base::wait_server_startup_end() {
     fd_ = 0;
 }
 
+#else  // thread-per-client
+
+void server_client_base::start_server_client() {
+    server_startup_start();
+    client_threads_.reserve(nproc_);
+    for (int i = 0; i < nproc_; i++) {
+        client_threads_.emplace_back([this] {
+            // wait server startup and go!
+            wait_server_startup_end();
+            client();
+        });
+    }
+    server();
+}
+
+void server_client_base::server_startup_start() {
+    server_ready_future_ = server_ready_.get_future().share();
+}
+
+void server_client_base::server_startup_end() {
+    server_ready_.set_value();
+}
+
+void server_client_base::wait_server_startup_end() {
+    server_ready_future_.wait();
+}
+
+#endif
+
 } // namespace tateyama::endpoint::ipc
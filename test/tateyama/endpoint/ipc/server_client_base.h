@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 #pragma once
+#include <future>
+
 #include <tateyama/framework/server.h>
 #include "ipc_test_utils.h"
 #include <sys/types.h>
@@ -56,17 +58,24 @@ protected:
     }
 
 private:
-    // for server process
+    // for server side
     void wait_client_exit();
     void server_startup_start();
     void server_startup_end();
-    // for client process
+    // for client side
     void wait_server_startup_end();
 
+    // clients run as threads of this process by default; define TATEYAMA_TEST_USE_FORK
+    // to run each client in a fork()ed process when address-space isolation is required
+#ifdef TATEYAMA_TEST_USE_FORK
     std::vector<pid_t> client_pids_ { };
-    std::vector<std::thread> threads_ { };
     std::string lock_filename_ { };
     int fd_ { };
+#else
+    std::vector<std::thread> client_threads_ { };
+    std::promise<void> server_ready_ { };
+    std::shared_future<void> server_ready_future_ { };
+#endif
 };
 
 } // namespace tateyama::endpoint::ipc
@@ -22,6 +22,17 @@
 namespace tateyama::api::endpoint::loopback {
 
 class loopback_response_test: public loopback_test_base {
+public:
+    static std::vector<std::string> const* find_committed(
+            std::vector<std::pair<std::string, std::vector<std::string>>> const& data_map,
+            std::string_view name) {
+        for (auto& entry : data_map) {
+            if (entry.first == name) {
+                return std::addressof(entry.second);
+            }
+        }
+        return nullptr;
+    }
 };
 
 TEST_F(loopback_response_test, empty) {
@@ -91,8 +102,8 @@ TEST_F(loopback_response_test, single) {
     //
     auto &data_map = response.all_committed_data();
     EXPECT_EQ(data_map.size(), 1);
-    EXPECT_NE(data_map.find(name), data_map.cend());
-    auto &result = data_map.find(name)->second;
+    ASSERT_NE(find_committed(data_map, name), nullptr);
+    auto &result = *find_committed(data_map, name);
     EXPECT_EQ(result.size(), test_data.size());
     for (int i = 0; i < result.size(); i++) {
         EXPECT_EQ(result[i], test_data[i]);
@@ -165,8 +176,8 @@ TEST_F(loopback_response_test, dual_channel) {
     EXPECT_EQ(data_map.size(), names.size());
     //
     for (const auto &name : names) {
-        EXPECT_NE(data_map.find(name), data_map.cend());
-        auto &result = data_map.find(name)->second;
+        ASSERT_NE(find_committed(data_map, name), nullptr);
+        auto &result = *find_committed(data_map, name);
         EXPECT_EQ(result.size(), test_data.size());
         for (int i = 0; i < result.size(); i++) {
             EXPECT_EQ(result[i], test_data[name][i]);
@@ -193,8 +204,8 @@ TEST_F(loopback_response_test, empty_channel_name) {
     //
     auto &data_map = response.all_committed_data();
     EXPECT_EQ(data_map.size(), 1);
-    EXPECT_NE(data_map.find(name), data_map.cend());
-    auto &result = data_map.find(name)->second;
+    ASSERT_NE(find_committed(data_map, name), nullptr);
+    auto &result = *find_committed(data_map, name);
     EXPECT_EQ(result.size(), test_data.size());
     for (int i = 0; i < result.size(); i++) {
         EXPECT_EQ(result[i], test_data[i]);
@@ -241,11 +252,11 @@ TEST_F(loopback_response_test, parallel_writer) {
     //
     auto &data_map = response.all_committed_data();
     EXPECT_EQ(data_map.size(), 1);
-    EXPECT_NE(data_map.find(name), data_map.cend());
+    ASSERT_NE(find_committed(data_map, name), nullptr);
     //
     std::set<std::string> resultset { };
     const auto cend = resultset.cend();
-    for (const auto &d : data_map.find(name)->second) {
+    for (const auto &d : *find_committed(data_map, name)) {
         resultset.emplace(d);
     }
     for (int i = 0; i < nwriter; i++) {
@@ -294,10 +305,10 @@ TEST_F(loopback_response_test, parallel_channel) {
     //
     for (int i = 0; i < nchannel; i++) {
         const std::string name { std::to_string(i) };
-        EXPECT_NE(data_map.find(name), data_map.cend());
+        ASSERT_NE(find_committed(data_map, name), nullptr);
         std::set<std::string> resultset { };
         const auto cend = resultset.cend();
-        for (const auto &d : data_map.find(name)->second) {
+        for (const auto &d : *find_committed(data_map, name)) {
             resultset.emplace(d);
         }
         std::string s { };
@@ -372,10 +383,10 @@ TEST_F(loopback_response_test, parallel_channel_and_wrier) {
     //
     for (int i = 0; i < nchannel; i++) {
         const std::string name { std::to_string(i) };
-        EXPECT_NE(data_map.find(name), data_map.cend());
+        ASSERT_NE(find_committed(data_map, name), nullptr);
         std::set<std::string> resultset { };
         const auto cend = resultset.cend();
-        for (const auto &d : data_map.find(name)->second) {
+        for (const auto &d : *find_committed(data_map, name)) {
             resultset.emplace(d);
         }
         std::string s { };
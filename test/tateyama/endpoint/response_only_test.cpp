@@ -24,6 +24,8 @@
 #include <tateyama/endpoint/ipc/bootstrap/server_wires_impl.h>
 #include "header_utils.h"
 
+#include <tateyama/endpoint/shm_utils.h>
+
 #include <gtest/gtest.h>
 
 namespace tateyama::endpoint::ipc {
@@ -32,14 +34,13 @@ class response_only_test : public ::testing::Test {
     static constexpr std::size_t datachannel_buffer_size = 64 * 1024;
 
     virtual void SetUp() {
-        rv_ = system("if [ -f /dev/shm/tateyama-response_only_test ]; then rm -f /dev/shm/tateyama-response_only_test; fi ");
+        remove_shm_entry("tateyama-response_only_test");
         wire_ = std::make_shared<bootstrap::server_wire_container_impl>("tateyama-response_only_test", "dummy_mutex_file_name", datachannel_buffer_size, 16);
     }
     virtual void TearDown() {
-        rv_ = system("if [ -f /dev/shm/tateyama-response_only_test ]; then rm -f /dev/shm/tateyama-response_only_test; fi ");
+        remove_shm_entry("tateyama-response_only_test");
     }
 
-    int rv_;
 
 public:
     static constexpr std::string_view request_test_message_ = "abcdefgh";
@@ -57,7 +58,7 @@ public:
     public:
         int operator()(
             std::shared_ptr<tateyama::api::server::request const> req,
-            std::shared_ptr<tateyama::api::server::response> res
+            std::shared_ptr<tateyama::api::server::response> const& res
         ) {
             auto payload = req->payload();
             EXPECT_EQ(request_test_message_, payload);
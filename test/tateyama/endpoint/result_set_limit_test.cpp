@@ -29,6 +29,8 @@
 #include <tateyama/endpoint/ipc/bootstrap/server_wires_impl.h>
 #include "header_utils.h"
 
+#include <tateyama/endpoint/shm_utils.h>
+
 #include <gtest/gtest.h>
 
 namespace tateyama::endpoint::ipc {
@@ -36,16 +38,15 @@ namespace tateyama::endpoint::ipc {
 class result_set_limit_test : public ::testing::Test {
     virtual void SetUp() {
 
-        rv_ = system("if [ -f /dev/shm/tateyama-result_set_limit_test ]; then rm -f /dev/shm/tateyama-result_set_limit_test; fi ");
+        remove_shm_entry("tateyama-result_set_limit_test");
 
         wire_ = std::make_shared<bootstrap::server_wire_container_impl>("tateyama-result_set_limit_test", "dummy_mutex_file_name", datachannel_buffer_size, writers);
         buffer.resize(value_size);
     }
     virtual void TearDown() {
-        rv_ = system("if [ -f /dev/shm/tateyama-result_set_limit_test ]; then rm -f /dev/shm/tateyama-result_set_limit_test*; fi ");
+        remove_shm_entries("tateyama-result_set_limit_test");
     }
 
-    int rv_;
 
 public:
     static constexpr std::size_t datachannel_buffer_size = 64 * 1024;
@@ -25,6 +25,8 @@
 #include <tateyama/endpoint/ipc/bootstrap/server_wires_impl.h>
 #include "header_utils.h"
 
+#include <tateyama/endpoint/shm_utils.h>
+
 #include <gtest/gtest.h>
 
 namespace tateyama::endpoint::ipc {
@@ -34,16 +36,15 @@ class result_set_test : public ::testing::Test {
 
     virtual void SetUp() {
 
-        rv_ = system("if [ -f /dev/shm/tateyama-result_set_test ]; then rm -f /dev/shm/tateyama-result_set_test; fi ");
+        remove_shm_entry("tateyama-result_set_test");
 
         wire_ = std::make_shared<bootstrap::server_wire_container_impl>("tateyama-result_set_test", "dummy_mutex_file_name", datachannel_buffer_size, 16);
 
     }
     virtual void TearDown() {
-        rv_ = system("if [ -f /dev/shm/tateyama-result_set_test ]; then rm -f /dev/shm/tateyama-result_set_test*; fi ");
+        remove_shm_entries("tateyama-result_set_test");
     }
 
-    int rv_;
 
 public:
     static constexpr std::string_view request_test_message_ = "abcdefgh";
@@ -63,7 +64,7 @@ public:
     public:
         int operator()(
             std::shared_ptr<tateyama::api::server::request const> req,
-            std::shared_ptr<tateyama::api::server::response> res
+            std::shared_ptr<tateyama::api::server::response> const& res
         ) {
             auto payload = req->payload();
             EXPECT_EQ(request_test_message_, payload);
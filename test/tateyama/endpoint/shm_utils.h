@@ -0,0 +1,48 @@
+/*
+ * Copyright 2018-2024 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include <string>
+
+#include <boost/filesystem.hpp>
+#include <boost/interprocess/shared_memory_object.hpp>
+
+namespace tateyama::endpoint {
+
+/**
+ * @brief remove the shared memory entry of the given name if it exists
+ * @details replaces shelling out to "rm -f /dev/shm/..." in test fixtures,
+ * which forked a shell per SetUp/TearDown
+ */
+inline void remove_shm_entry(std::string const& name) {
+    boost::interprocess::shared_memory_object::remove(name.c_str());
+}
+
+/**
+ * @brief remove all shared memory entries whose name begins with the given prefix
+ * @details data channel wires create additional segments suffixed to the base name,
+ * which the fixtures formerly cleaned up with a shell glob
+ */
+inline void remove_shm_entries(std::string const& prefix) {
+    boost::system::error_code ec{};
+    for (boost::filesystem::directory_iterator it{"/dev/shm", ec}, end{}; !ec && it != end; it.increment(ec)) {
+        if (auto name = it->path().filename().string(); name.compare(0, prefix.size(), prefix) == 0) {
+            boost::system::error_code rec{};
+            boost::filesystem::remove(it->path(), rec);
+        }
+    }
+}
+
+}  // namespace tateyama::endpoint
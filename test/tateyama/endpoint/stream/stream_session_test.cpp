@@ -39,8 +39,8 @@ public:
     bool shutdown(tateyama::framework::environment&) { return true; }
 
     id_type id() const noexcept { return service_id_of_session_service;  }
-    bool operator ()(std::shared_ptr<tateyama::api::server::request> req,
-                     std::shared_ptr<tateyama::api::server::response> res) override {
+    bool operator ()(std::shared_ptr<tateyama::api::server::request> const& req,
+                     std::shared_ptr<tateyama::api::server::response> const& res) override {
         req_ = req;
         res_ = res;
         // do not respond to the request message here in this test
@@ -41,8 +41,8 @@ public:
     std::string_view label() const noexcept { return __func__; }
 
     id_type id() const noexcept { return service_id_of_store_service; }
-    bool operator ()(std::shared_ptr<tateyama::api::server::request> req,
-                     std::shared_ptr<tateyama::api::server::response> res) override {
+    bool operator ()(std::shared_ptr<tateyama::api::server::request> const& req,
+                     std::shared_ptr<tateyama::api::server::response> const& res) override {
         req_ = req;
         res->body(response_test_message);
         return true;
@@ -21,6 +21,8 @@
 
 #include <tateyama/endpoint/ipc/bootstrap/server_wires_impl.h>
 
+#include <tateyama/endpoint/shm_utils.h>
+
 #include <gtest/gtest.h>
 
 namespace tateyama::endpoint::ipc {
@@ -29,14 +31,13 @@ class wire_test : public ::testing::Test {
     static constexpr std::size_t datachannel_buffer_size = 64 * 1024;
 
     virtual void SetUp() {
-        rv_ = system("if [ -f /dev/shm/tateyama-wire_test ]; then rm -f /dev/shm/tateyama-wire_test; fi ");
+        remove_shm_entry("tateyama-wire_test");
         wire_ = std::make_unique<bootstrap::server_wire_container_impl>("tateyama-wire_test", "dummy_mutex_file_name", datachannel_buffer_size, 16);
     }
     virtual void TearDown() {
-        rv_ = system("if [ -f /dev/shm/tateyama-wire_test ]; then rm -f /dev/shm/tateyama-wire_test*; fi ");
+        remove_shm_entries("tateyama-wire_test");
     }
 
-    int rv_;
 
 public:
     std::string request_test_message_{};
@@ -65,8 +65,8 @@ public:
         }
 
         bool operator()(
-            std::shared_ptr<request> req,
-            std::shared_ptr<response> res) override {
+            std::shared_ptr<request> const& req,
+            std::shared_ptr<response> const& res) override {
             (void)req;
             (void)res;
             return true;
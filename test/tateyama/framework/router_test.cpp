@@ -56,7 +56,7 @@ public:
         [[nodiscard]] id_type id() const noexcept override {
             return tag;
         }
-        bool operator()(std::shared_ptr<request>, std::shared_ptr<response>) override {
+        bool operator()(std::shared_ptr<request> const&, std::shared_ptr<response> const&) override {
             called_ = true;
             return true;
         }
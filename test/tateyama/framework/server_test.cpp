@@ -77,7 +77,7 @@ public:
     [[nodiscard]] id_type id() const noexcept override {
         return tag;
     }
-    bool operator()(std::shared_ptr<request>, std::shared_ptr<response>) override { return true; }
+    bool operator()(std::shared_ptr<request> const&, std::shared_ptr<response> const&) override { return true; }
     bool setup(environment&) override { return true; }
     bool start(environment&) override { return true; }
     bool shutdown(environment&) override { return true; }
@@ -91,7 +91,7 @@ public:
     [[nodiscard]] id_type id() const noexcept override {
         return tag;
     }
-    bool operator()(std::shared_ptr<request>, std::shared_ptr<response>) override { return true; }
+    bool operator()(std::shared_ptr<request> const&, std::shared_ptr<response> const&) override { return true; }
     bool setup(environment&) override { return true; }
     bool start(environment&) override { return true; }
     bool shutdown(environment&) override { return true; }
@@ -50,7 +50,7 @@ TEST_F(buffered_response_test, multi_channel) {
     const std::string body_head { "body_head" };
     const std::string body { "body message" };
     const std::vector<std::string> names = { "channelA", "channelB" };
-    const std::map<std::string, std::vector<std::string>, std::less<>> test_data_org { { names[0], { "hello",
+    const std::vector<std::pair<std::string, std::vector<std::string>>> test_data_org { { names[0], { "hello",
             "this is a pen" } }, { names[1], { "good night", "it's fine today" } } };
     {
         auto test_data { test_data_org };
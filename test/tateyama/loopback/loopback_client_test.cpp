@@ -13,6 +13,8 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cstdio>
+
 #include <tateyama/framework/server.h>
 
 #include <tateyama/framework/resource.h>
@@ -38,12 +40,13 @@ public:
     }
 };
 
+/**
+ * @brief service with the channel/writer/record counts as template parameters,
+ * so the compiler can fold the loop bounds and unroll the write loops
+ */
+template<int NCH, int NW, int NL>
 class data_channel_service: public tateyama::framework::service {
 public:
-    data_channel_service(int nchannel, int nwrite, int nloop) :
-            nchannel_(nchannel), nwrite_(nwrite), nloop_(nloop) {
-    }
-
     static constexpr tateyama::framework::component::id_type tag = 1234;
     [[nodiscard]] tateyama::framework::component::id_type id() const noexcept override {
         return tag;
@@ -66,30 +69,47 @@ public:
     static constexpr std::string_view body_head = "body_head";
 
     static std::string channel_name(int ch) {
-        return "ch" + std::to_string(ch);
+        char buf[32];  // NOLINT
+        auto len = std::snprintf(&buf[0], sizeof(buf), "ch%d", ch);
+        return std::string { &buf[0], static_cast<std::size_t>(len) };
+    }
+
+    // formats into the caller's stack buffer, so the writer loop allocates nothing
+    static std::size_t channel_data(char (&buf)[32], int ch, int w, int i) {  // NOLINT
+        return static_cast<std::size_t>(std::snprintf(&buf[0], sizeof(buf), "ch%d-w%d-%d", ch, w, i));
     }
 
     static std::string channel_data(int ch, int w, int i) {
-        return channel_name(ch) + "-w" + std::to_string(w) + "-" + std::to_string(i);
+        char buf[32];  // NOLINT
+        auto len = channel_data(buf, ch, w, i);
+        return std::string { &buf[0], len };
     }
 
-    bool operator ()(std::shared_ptr<tateyama::api::server::request> req,
-            std::shared_ptr<tateyama::api::server::response> res) override {
+    bool operator ()(std::shared_ptr<tateyama::api::server::request> const& req,
+            std::shared_ptr<tateyama::api::server::response> const& res) override {
         res->session_id(req->session_id());
         EXPECT_EQ(res->body_head(body_head), tateyama::status::ok);
         //
-        for (int ch = 0; ch < nchannel_; ch++) {
+        for (int ch = 0; ch < NCH; ch++) {
             std::shared_ptr<tateyama::api::server::data_channel> channel;
             std::string name { channel_name(ch) };
             EXPECT_EQ(tateyama::status::ok, res->acquire_channel(name, channel));
-            for (int w = 0; w < nwrite_; w++) {
+            for (int w = 0; w < NW; w++) {
                 std::shared_ptr<tateyama::api::server::writer> writer;
                 EXPECT_EQ(tateyama::status::ok, channel->acquire(writer));
-                for (int i = 0; i < nloop_; i++) {
-                    std::string data { channel_data(ch, w, i) };
-                    EXPECT_EQ(writer->write(data.c_str(), data.length()), tateyama::status::ok);
-                    EXPECT_EQ(writer->commit(), tateyama::status::ok);
+                // commit() delimits records, so it must stay per record; the record text
+                // is formatted into a stack buffer, keeping the loop free of heap traffic.
+                // the status checks are folded into one flag so the GoogleTest result
+                // bookkeeping stays out of the innermost loop (ASSERT_* cannot be used
+                // here: operator() does not return void)
+                char buf[32];  // NOLINT
+                bool write_ok = true;
+                for (int i = 0; i < NL; i++) {
+                    auto len = channel_data(buf, ch, w, i);
+                    write_ok = write_ok && (writer->write(&buf[0], len) == tateyama::status::ok);
+                    write_ok = write_ok && (writer->commit() == tateyama::status::ok);
                 }
+                EXPECT_TRUE(write_ok);
                 EXPECT_EQ(channel->release(*writer), tateyama::status::ok);
             }
             EXPECT_EQ(res->release_channel(*channel), tateyama::status::ok);
@@ -97,47 +117,43 @@ public:
         EXPECT_EQ(res->body(req->payload()), tateyama::status::ok);
         return true;
     }
-
-private:
-    const int nchannel_;
-    const int nwrite_;
-    const int nloop_;
 };
 
 TEST_F(loopback_client_test, single) {
+    constexpr int nchannel = 5;
+    constexpr int nwriter = 5;
+    constexpr int nloop = 10;
+    using test_service = data_channel_service<nchannel, nwriter, nloop>;
     const std::size_t session_id = 123;
-    const std::size_t service_id = data_channel_service::tag;
+    const std::size_t service_id = test_service::tag;
     const std::string request { "loopback_test" };
-    const int nchannel = 5;
-    const int nwriter = 5;
-    const int nloop = 10;
     //
     auto cfg = api::configuration::create_configuration("", tateyama::test::default_configuration_for_tests);
     set_dbpath(*cfg);
     tateyama::loopback::loopback_client loopback;
     tateyama::framework::server sv { tateyama::framework::boot_mode::database_server, cfg };
     sv.add_service(std::make_shared<framework::routing_service>());
-    sv.add_service(std::make_shared<data_channel_service>(nchannel, nwriter, nloop));
+    sv.add_service(std::make_shared<test_service>());
     sv.add_endpoint(loopback.endpoint());
     ASSERT_TRUE(sv.start());
     //
     const auto response = loopback.request(session_id, service_id, request);
     EXPECT_EQ(response.session_id(), session_id);
-    EXPECT_EQ(response.body_head(), data_channel_service::body_head);
+    EXPECT_EQ(response.body_head(), test_service::body_head);
     EXPECT_EQ(response.body(), request);
     auto &error_rec = response.error();
     EXPECT_EQ(error_rec.code(), 0);
     EXPECT_TRUE(error_rec.message().empty());
     //
     for (int ch = 0; ch < nchannel; ch++) {
-        std::string name { std::move(data_channel_service::channel_name(ch)) };
+        std::string name { std::move(test_service::channel_name(ch)) };
         EXPECT_TRUE(response.has_channel(name));
         const std::vector<std::string> &ch_data = response.channel(name);
         EXPECT_EQ(ch_data.size(), nwriter * nloop);
         int idx = 0;
         for (int w = 0; w < nwriter; w++) {
             for (int i = 0; i < nloop; i++) {
-                std::string data { std::move(data_channel_service::channel_data(ch, w, i)) };
+                std::string data { std::move(test_service::channel_data(ch, w, i)) };
                 EXPECT_EQ(ch_data[idx++], data);
             }
         }
@@ -147,12 +163,13 @@ TEST_F(loopback_client_test, single) {
 }
 
 TEST_F(loopback_client_test, multi_request) {
+    constexpr int nchannel = 5;
+    constexpr int nwriter = 5;
+    constexpr int nloop = 10;
+    using test_service = data_channel_service<nchannel, nwriter, nloop>;
     const std::size_t session_id = 123;
-    const std::size_t service_id = data_channel_service::tag;
+    const std::size_t service_id = test_service::tag;
     const std::string request { "loopback_test" };
-    const int nchannel = 5;
-    const int nwriter = 5;
-    const int nloop = 10;
     const int nrequest = 10;
     //
     auto cfg = api::configuration::create_configuration("", tateyama::test::default_configuration_for_tests);
@@ -160,28 +177,28 @@ TEST_F(loopback_client_test, multi_request) {
     tateyama::loopback::loopback_client loopback;
     tateyama::framework::server sv { tateyama::framework::boot_mode::database_server, cfg };
     add_core_components(sv);
-    sv.add_service(std::make_shared<data_channel_service>(nchannel, nwriter, nloop));
+    sv.add_service(std::make_shared<test_service>());
     sv.add_endpoint(loopback.endpoint());
     ASSERT_TRUE(sv.start());
     //
     for (int r = 0; r < nrequest; r++) {
         const auto response = loopback.request(session_id, service_id, request);
         EXPECT_EQ(response.session_id(), session_id);
-        EXPECT_EQ(response.body_head(), data_channel_service::body_head);
+        EXPECT_EQ(response.body_head(), test_service::body_head);
         EXPECT_EQ(response.body(), request);
         auto &error_rec = response.error();
         EXPECT_EQ(error_rec.code(), 0);
         EXPECT_TRUE(error_rec.message().empty());
         //
         for (int ch = 0; ch < nchannel; ch++) {
-            std::string name { std::move(data_channel_service::channel_name(ch)) };
+            std::string name { std::move(test_service::channel_name(ch)) };
             EXPECT_TRUE(response.has_channel(name));
             const std::vector<std::string> &ch_data = response.channel(name);
             EXPECT_EQ(ch_data.size(), nwriter * nloop);
             int idx = 0;
             for (int w = 0; w < nwriter; w++) {
                 for (int i = 0; i < nloop; i++) {
-                    std::string data { std::move(data_channel_service::channel_data(ch, w, i)) };
+                    std::string data { std::move(test_service::channel_data(ch, w, i)) };
                     EXPECT_EQ(ch_data[idx++], data);
                 }
             }
@@ -192,8 +209,9 @@ TEST_F(loopback_client_test, multi_request) {
 }
 
 TEST_F(loopback_client_test, unknown_service_id) {
+    using test_service = data_channel_service<0, 0, 0>;
     const std::size_t session_id = 123;
-    const std::size_t service_id = data_channel_service::tag;
+    const std::size_t service_id = test_service::tag;
     const std::size_t invalid_service_id = service_id + 1;
     const std::string request { "loopback_test" };
     //
@@ -202,7 +220,7 @@ TEST_F(loopback_client_test, unknown_service_id) {
     tateyama::loopback::loopback_client loopback;
     tateyama::framework::server sv { tateyama::framework::boot_mode::database_server, cfg };
     add_core_components(sv);
-    sv.add_service(std::make_shared<data_channel_service>(0, 0, 0));
+    sv.add_service(std::make_shared<test_service>());
     sv.add_endpoint(loopback.endpoint());
     ASSERT_TRUE(sv.start());
     //
@@ -20,6 +20,8 @@
 #include <tateyama/framework/server.h>
 #include <tateyama/framework/routing_service.h>
 
+#include <google/protobuf/arena.h>
+
 #include <tateyama/proto/session/request.pb.h>
 #include <tateyama/proto/session/response.pb.h>
 
@@ -28,6 +30,16 @@
 
 namespace tateyama::session {
 
+// the session_list request is a constant (version 1.0, empty sub-message), so it is
+// serialized once for the whole file
+static const std::string session_list_request_bytes = []{ // NOLINT
+    ::tateyama::proto::session::request::Request rq{};
+    rq.set_service_message_version_major(1);
+    rq.set_service_message_version_minor(0);
+    rq.mutable_session_list();
+    return rq.SerializeAsString();
+}();
+
 class session_gc_test :
     public ::testing::Test,
     public test::test_utils
@@ -35,7 +47,7 @@ class session_gc_test :
 public:
     void SetUp() override {
         temporary_.prepare();
-        session_context_ = std::make_shared<tateyama::session::resource::session_context_impl>(session_info_for_existing_session_, tateyama::session::session_variable_set(variable_declarations_));
+        session_context_ = std::make_shared<tateyama::session::resource::session_context_impl>(session_info_for_existing_session_, tateyama::session::session_variable_set(variable_declarations()));
     }
     void TearDown() override {
         temporary_.clean();
@@ -43,9 +55,13 @@ public:
 
 private:
     tateyama::endpoint::common::session_info_impl session_info_for_existing_session_{111, "IPC", "9999", "label_fot_test", "application_for_test", "user_fot_test"};
-    std::vector<std::tuple<std::string, tateyama::session::session_variable_set::variable_type, tateyama::session::session_variable_set::value_type>> variable_declarations_ {
-        {"test_integer", tateyama::session::session_variable_type::signed_integer, static_cast<std::int64_t>(123)}
-    };
+    // built as a prvalue at the call site, so the declaration list is moved into
+    // session_variable_set instead of being copied from a member per SetUp()
+    static std::vector<std::tuple<std::string, tateyama::session::session_variable_set::variable_type, tateyama::session::session_variable_set::value_type>> variable_declarations() {
+        return {
+            {"test_integer", tateyama::session::session_variable_type::signed_integer, static_cast<std::int64_t>(123)}
+        };
+    }
 
 protected:
     std::shared_ptr<tateyama::session::resource::session_context_impl> session_context_{};
@@ -63,80 +79,53 @@ TEST_F(session_gc_test, session_list) {
 
     auto ss = sv.find_resource<session::resource::bridge>();
 
-    {
-        std::string str{};
-        {
-            ::tateyama::proto::session::request::Request rq{};
-            rq.set_service_message_version_major(1);
-            rq.set_service_message_version_minor(0);
-            auto slrq = rq.mutable_session_list();
-            str = rq.SerializeAsString();
-            rq.clear_session_list();
-        }
-
-        auto svrreq = std::make_shared<test_request>(10, session::service::bridge::tag, str);
-        auto svrres = std::make_shared<test_response>();
+    // one arena serves the three response parses
+    google::protobuf::Arena arena{};
 
+    // the service does not retain the request beyond the call, so one instance
+    // serves all three probes; responses stay per probe, as each latches its body
+    auto svrreq = std::make_shared<test_request>(10, session::service::bridge::tag, session_list_request_bytes);
+    auto svrres = std::make_shared<test_response>();
+    // one parsed message serves all three probes; Clear() keeps the repeated-field capacity
+    auto* slrs = google::protobuf::Arena::CreateMessage<::tateyama::proto::session::response::SessionList>(&arena);
+
+    {
         (*router)(svrreq, svrres);
         EXPECT_EQ(10, svrres->session_id_);
         auto& body = svrres->body_;
 
-        ::tateyama::proto::session::response::SessionList slrs{};
-        EXPECT_TRUE(slrs.ParseFromString(body));
-        EXPECT_TRUE(slrs.has_success());
-        auto success = slrs.success();
+        slrs->Clear();
+        EXPECT_TRUE(slrs->ParseFromString(body));
+        EXPECT_TRUE(slrs->has_success());
+        const auto& success = slrs->success();
         EXPECT_EQ(0, success.entries_size());
     }
 
     ss->register_session(session_context_);
     {
-        std::string str{};
-        {
-            ::tateyama::proto::session::request::Request rq{};
-            rq.set_service_message_version_major(1);
-            rq.set_service_message_version_minor(0);
-            auto slrq = rq.mutable_session_list();
-            str = rq.SerializeAsString();
-            rq.clear_session_list();
-        }
-
-        auto svrreq = std::make_shared<test_request>(10, session::service::bridge::tag, str);
-        auto svrres = std::make_shared<test_response>();
-
+        svrres->reset();
         (*router)(svrreq, svrres);
         EXPECT_EQ(10, svrres->session_id_);
         auto& body = svrres->body_;
 
-        ::tateyama::proto::session::response::SessionList slrs{};
-        EXPECT_TRUE(slrs.ParseFromString(body));
-        EXPECT_TRUE(slrs.has_success());
-        auto success = slrs.success();
+        slrs->Clear();
+        EXPECT_TRUE(slrs->ParseFromString(body));
+        EXPECT_TRUE(slrs->has_success());
+        const auto& success = slrs->success();
         EXPECT_EQ(1, success.entries_size());
     }
 
     session_context_ = nullptr;
     {
-        std::string str{};
-        {
-            ::tateyama::proto::session::request::Request rq{};
-            rq.set_service_message_version_major(1);
-            rq.set_service_message_version_minor(0);
-            auto slrq = rq.mutable_session_list();
-            str = rq.SerializeAsString();
-            rq.clear_session_list();
-        }
-
-        auto svrreq = std::make_shared<test_request>(10, session::service::bridge::tag, str);
-        auto svrres = std::make_shared<test_response>();
-
+        svrres->reset();
         (*router)(svrreq, svrres);
         EXPECT_EQ(10, svrres->session_id_);
         auto& body = svrres->body_;
 
-        ::tateyama::proto::session::response::SessionList slrs{};
-        EXPECT_TRUE(slrs.ParseFromString(body));
-        EXPECT_TRUE(slrs.has_success());
-        auto success = slrs.success();
+        slrs->Clear();
+        EXPECT_TRUE(slrs->ParseFromString(body));
+        EXPECT_TRUE(slrs->has_success());
+        const auto& success = slrs->success();
         EXPECT_EQ(0, success.entries_size());
     }
 
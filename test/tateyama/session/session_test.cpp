@@ -37,7 +37,7 @@ class session_test :
 public:
     void SetUp() override {
         temporary_.prepare();
-        session_context_ = std::make_shared<tateyama::session::resource::session_context_impl>(session_info_for_existing_session_, tateyama::session::session_variable_set(variable_declarations_));
+        session_context_ = std::make_shared<tateyama::session::resource::session_context_impl>(session_info_for_existing_session_, tateyama::session::session_variable_set(variable_declarations()));
     }
     void TearDown() override {
         temporary_.clean();
@@ -45,9 +45,13 @@ public:
 
 private:
     tateyama::endpoint::common::session_info_impl session_info_for_existing_session_{111, "IPC", "9999", "label_fot_test", "application_for_test", "user_fot_test"};
-    std::vector<std::tuple<std::string, tateyama::session::session_variable_set::variable_type, tateyama::session::session_variable_set::value_type>> variable_declarations_ {
-        {"test_integer", tateyama::session::session_variable_type::signed_integer, static_cast<std::int64_t>(123)}
-    };
+    // built as a prvalue at the call site, so the declaration list is moved into
+    // session_variable_set instead of being copied from a member per SetUp()
+    static std::vector<std::tuple<std::string, tateyama::session::session_variable_set::variable_type, tateyama::session::session_variable_set::value_type>> variable_declarations() {
+        return {
+            {"test_integer", tateyama::session::session_variable_type::signed_integer, static_cast<std::int64_t>(123)}
+        };
+    }
 
 protected:
     std::shared_ptr<tateyama::session::resource::session_context_impl> session_context_{};
@@ -64,7 +64,7 @@ public:
     
     std::size_t session_id_{};
     std::size_t service_id_{};
-    std::string payload_{};
+    std::string_view payload_{};  // a view; the caller keeps the serialized request alive
     
     tateyama::status_info::resource::database_info_impl database_info_{};
     tateyama::endpoint::common::session_info_impl session_info_{};
@@ -73,17 +73,26 @@ public:
 
 class test_response : public api::server::response {
 public:
-    test_response() = default;
+    test_response() {
+        body_.reserve(4096);
+    }
     
     void session_id(std::size_t id) override {
         session_id_ = id;
     };
     status body_head(std::string_view body_head) override { return status::ok; }
-    status body(std::string_view body) override { body_ = body; body_arrived_ = true; return status::ok; }
+    status body(std::string_view body) override { body_.assign(body.data(), body.size()); body_arrived_ = true; return status::ok; }
     void error(proto::diagnostics::Record const& record) override {}
     status acquire_channel(std::string_view name, std::shared_ptr<api::server::data_channel>& ch) override { return status::ok; }
     status release_channel(api::server::data_channel& ch) override { return status::ok; }
     bool check_cancel() const override { return false; }
+    // returns the object to its initial state so one instance can serve repeated calls;
+    // body_ keeps its capacity
+    void reset() {
+        session_id_ = 0;
+        body_.clear();
+        body_arrived_ = false;
+    }
     std::string& wait_and_get_body() {
         while (!body_arrived_) {
             std::this_thread::sleep_for(std::chrono::milliseconds(10));
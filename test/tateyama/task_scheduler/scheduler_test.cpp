@@ -129,8 +129,8 @@ TEST_F(scheduler_test, sticky_task_simple) {
     scheduler<task> sched{cfg, true};
 
     auto& w0 = sched.workers()[0];
-    auto& lq0 = sched.queues()[0];
-    auto& sq0 = sched.sticky_task_queues()[0];
+    auto& lq0 = sched.queues()[0].local;
+    auto& sq0 = sched.queues()[0].sticky;
     bool executed00 = false;
     bool executed01 = false;
     bool executed02 = false;
@@ -147,7 +147,7 @@ TEST_F(scheduler_test, sticky_task_simple) {
     sched.schedule_at(task{test_task_sticky{[&](context& t) {
         executed02 = true;
     }}}, 0);
-    auto& ctx = sched.contexts()[0];
+    auto& ctx = sched.contexts()[0].data;
     w0.init(thread_initialization_info{0}, ctx);
 
     w0.process_next(ctx, lq0, sq0);
@@ -168,10 +168,10 @@ TEST_F(scheduler_test, sticky_task_stealing) {
 
     auto& w0 = sched.workers()[0];
     auto& w1 = sched.workers()[1];
-    auto& lq0 = sched.queues()[0];
-    auto& lq1 = sched.queues()[1];
-    auto& sq0 = sched.sticky_task_queues()[0];
-    auto& sq1 = sched.sticky_task_queues()[1];
+    auto& lq0 = sched.queues()[0].local;
+    auto& lq1 = sched.queues()[1].local;
+    auto& sq0 = sched.queues()[0].sticky;
+    auto& sq1 = sched.queues()[1].sticky;
     bool executed00 = false;
     bool executed10 = false;
     bool executed11 = false;
@@ -184,7 +184,7 @@ TEST_F(scheduler_test, sticky_task_stealing) {
     sched.schedule_at(task{test_task_sticky{[&](context& t) {
         executed10 = true;
     }}}, 1);
-    auto& ctx = sched.contexts()[0];
+    auto& ctx = sched.contexts()[0].data;
     w0.init(thread_initialization_info{0}, ctx);
     w0.init(thread_initialization_info{1}, ctx);
 
@@ -206,8 +206,8 @@ TEST_F(scheduler_test, sticky_tasks) {
     scheduler<task> sched{cfg, true};
 
     auto& w0 = sched.workers()[0];
-    auto& lq0 = sched.queues()[0];
-    auto& sq0 = sched.sticky_task_queues()[0];
+    auto& lq0 = sched.queues()[0].local;
+    auto& sq0 = sched.queues()[0].sticky;
     bool executed00 = false;
     bool executed01 = false;
     bool executed02 = false;
@@ -232,7 +232,7 @@ TEST_F(scheduler_test, sticky_tasks) {
     sched.schedule_at(task{test_task_sticky{[&](context& t) {
         executed04 = true;
     }}}, 0);
-    auto& ctx = sched.contexts()[0];
+    auto& ctx = sched.contexts()[0].data;
     w0.init(thread_initialization_info{0}, ctx);
 
     w0.process_next(ctx, lq0, sq0);
@@ -250,4 +250,41 @@ TEST_F(scheduler_test, sticky_tasks) {
     w0.process_next(ctx, lq0, sq0);
 }
 
+TEST_F(scheduler_test, schedule_bulk) {
+    // verify bulk submission distributes tasks to local/sticky queues same as per-task schedule_at
+    using task = tateyama::task_scheduler::basic_task<test_task, test_task_sticky>;
+    task_scheduler_cfg cfg{};
+    cfg.thread_count(1);
+    scheduler<task> sched{cfg, true};
+
+    auto& w0 = sched.workers()[0];
+    auto& lq0 = sched.queues()[0].local;
+    auto& sq0 = sched.queues()[0].sticky;
+    bool executed00 = false;
+    bool executed01 = false;
+    bool executed02 = false;
+    std::vector<task> tasks{};
+    tasks.emplace_back(test_task{[&](context& t) {
+        executed00 = true;
+    }});
+    tasks.emplace_back(test_task{[&](context& t) {
+        executed01 = true;
+    }});
+    tasks.emplace_back(test_task_sticky{[&](context& t) {
+        executed02 = true;
+    }});
+    sched.schedule_bulk(tasks.data(), tasks.data() + tasks.size(), 0);
+    auto& ctx = sched.contexts()[0].data;
+    w0.init(thread_initialization_info{0}, ctx);
+    EXPECT_EQ(2, lq0.size());
+    EXPECT_EQ(1, sq0.size());
+
+    w0.process_next(ctx, lq0, sq0);
+    w0.process_next(ctx, lq0, sq0);
+    w0.process_next(ctx, lq0, sq0);
+    EXPECT_TRUE(executed00);
+    EXPECT_TRUE(executed01);
+    EXPECT_TRUE(executed02);
+}
+
 }